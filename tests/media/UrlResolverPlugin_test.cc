@@ -0,0 +1,99 @@
+#include <iostream>
+#include <fstream>
+#include <stdlib.h>
+#include <boost/test/unit_test.hpp>
+
+#include <zypp/Url.h>
+#include <zypp/TmpPath.h>
+#include <zypp/PathInfo.h>
+#include <zypp/ZConfig.h>
+#include <zypp/media/UrlResolverPlugin.h>
+
+using std::cout;
+using std::endl;
+using namespace zypp;
+using namespace zypp::media;
+
+namespace
+{
+  filesystem::TmpDir pluginsDir;
+
+  /** Number of lines in \a file_r */
+  unsigned lineCount( const Pathname & file_r )
+  {
+    std::ifstream in( file_r.c_str() );
+    unsigned ret = 0;
+    for ( std::string line; std::getline( in, line ); )
+      ++ret;
+    return ret;
+  }
+
+  /** Create an executable \a name_r plugin logging its starts and requests.
+   * A plugin with \a session_r set asks to be kept running and answers requests
+   * until its stdin is closed, otherwise it terminates after the first reply.
+   */
+  Pathname mkPlugin( const std::string & name_r, bool session_r )
+  {
+    Pathname plugin { pluginsDir.path() / "urlresolver" / name_r };
+    Pathname log { pluginsDir.path() / name_r };
+    std::ofstream out( plugin.c_str() );
+    out << "#!/bin/bash\n"
+        << "echo started >>'" << log << ".starts'\n"
+        << "while IFS= read -r -d '' FRAME; do\n"
+        << "  case \"$FRAME\" in\n"
+        << "    _DISCONNECT*) printf 'ACK\\n\\n\\0'; exit 0;;\n"
+        << "  esac\n"
+        << "  echo \"$FRAME\" | head -n1 >>'" << log << ".requests'\n"
+        << "  REPO=\"$(echo \"$FRAME\" | sed -n 's/^repo://p')\"\n"
+        << "  TTL=0; [ \"$REPO\" == \"cached\" ] && TTL=3600\n"
+        << "  printf 'RESOLVEDURL\\n" << ( session_r ? "X-Zypp-Resolver-Session:1\\n" : "" )
+        << "X-Zypp-Resolver-TTL:%s\\nfoo:bar\\n\\nhttp://example.com/%s\\0' \"$TTL\" \"$REPO\"\n"
+        << ( session_r ? "" : "  exit 0\n" )
+        << "done\n";
+    out.close();
+    filesystem::chmod( plugin, 0755 );
+    return log;
+  }
+
+  void checkResolve( const std::string & name_r, const std::string & repo_r )
+  {
+    UrlResolverPlugin::HeaderList headers;
+    Url url { UrlResolverPlugin::resolveUrl( Url( "plugin:"+name_r+"?repo="+repo_r ), headers ) };
+    BOOST_CHECK_EQUAL( url, Url( "http://example.com/"+repo_r ) );
+    BOOST_CHECK_EQUAL( headers.size(), 1 );
+    BOOST_CHECK_EQUAL( headers.count( "foo" ), 1 );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(urlresolver_init)
+{
+  // must be set before ZConfig is created
+  setenv( "ZYPP_TESTSUITE_PLUGINSDIR", pluginsDir.path().c_str(), 1 );
+  filesystem::assert_dir( pluginsDir.path() / "urlresolver" );
+  BOOST_REQUIRE_EQUAL( ZConfig::instance().pluginsPath(), pluginsDir.path() );
+}
+
+BOOST_AUTO_TEST_CASE(urlresolver_singleshot)
+{
+  // A plugin not asking for a session is started for each request.
+  Pathname log { mkPlugin( "single", false ) };
+  checkResolve( "single", "a" );
+  checkResolve( "single", "b" );
+  BOOST_CHECK_EQUAL( lineCount( log.extend( ".starts" ) ), 2 );
+  BOOST_CHECK_EQUAL( lineCount( log.extend( ".requests" ) ), 2 );
+}
+
+BOOST_AUTO_TEST_CASE(urlresolver_session)
+{
+  // A plugin asking for a session is started once.
+  Pathname log { mkPlugin( "session", true ) };
+  checkResolve( "session", "a" );
+  checkResolve( "session", "b" );
+  BOOST_CHECK_EQUAL( lineCount( log.extend( ".starts" ) ), 1 );
+  BOOST_CHECK_EQUAL( lineCount( log.extend( ".requests" ) ), 2 );
+
+  // A result passing a TTL is cached.
+  checkResolve( "session", "cached" );
+  checkResolve( "session", "cached" );
+  BOOST_CHECK_EQUAL( lineCount( log.extend( ".requests" ) ), 3 );
+}
@@ -4,6 +4,7 @@
 
 #include <zypp/ZYppFactory.h>
 #include <zypp/RepoManager.h>
+#include <zypp-core/fs/TarArchive.h>
 #include "TestSetup.h"
 
 using namespace boost::unit_test;
@@ -46,3 +47,14 @@ BOOST_AUTO_TEST_CASE(repolicense)
   BOOST_CHECK_EQUAL( ri.needToAcceptLicense( prod ), 	false );
   BOOST_CHECK      ( ri.getLicenseLocales( prod ).empty() );
 }
+
+BOOST_AUTO_TEST_CASE(repolicense_uncached)
+{
+  // Without a cached index the archive object is the only owner of the member list.
+  filesystem::TarArchive::clearCache();
+  const RepoInfo & ri( ResPool::instance().knownRepositoriesBegin()->info() );
+  BOOST_CHECK_EQUAL( ri.getLicenseLocales( "prod" ),	LocaleSet({ Locale(), Locale("de"), Locale("fr") }) );
+
+  filesystem::TarArchive::clearCache();
+  BOOST_CHECK_EQUAL( ri.getLicenseLocales(),		LocaleSet({ Locale(),Locale("de") }) );
+}
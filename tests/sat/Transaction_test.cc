@@ -0,0 +1,76 @@
+#include "TestSetup.h"
+#include <zypp/sat/Transaction.h>
+#include <zypp/ResPool.h>
+
+static std::vector<sat::Solvable> collect( const Iterable<sat::Transaction::const_iterator> & steps_r )
+{
+  std::vector<sat::Solvable> ret;
+  for ( const sat::Transaction::Step & step : steps_r )
+    ret.push_back( step.satSolvable() );
+  return ret;
+}
+
+static bool contains( const std::vector<sat::Solvable> & steps_r, const PoolItem & pi_r )
+{ return std::find( steps_r.begin(), steps_r.end(), pi_r.satSolvable() ) != steps_r.end(); }
+
+BOOST_AUTO_TEST_CASE(transaction_steps)
+{
+  TestSetup test( Arch_x86_64 );
+  test.loadTestcaseRepos( TESTS_SRC_DIR"/data/TCNamespaceRecommends" );
+
+  PoolItem Ap;	// update aspell
+  PoolItem Ig;	// delete glibc
+  PoolItem Apfr;	// unwanted locale, not in the transaction
+  for ( const PoolItem & pi : test.pool() )
+  {
+    if ( pi.name() == "aspell" && ! pi.isSystem() )
+      Ap = pi;
+    else if ( pi.name() == "glibc" && pi.isSystem() )
+      Ig = pi;
+    else if ( pi.name() == "aspell-fr" )
+      Apfr = pi;
+  }
+  BOOST_REQUIRE( Ap && Ig && Apfr );
+  Ap.status().setTransact( true, ResStatus::USER );
+  Ig.status().setTransact( true, ResStatus::USER );
+  BOOST_REQUIRE( test.resolver().resolvePool() );
+
+  sat::Transaction trans( test.resolver().getTransaction() );
+  BOOST_REQUIRE( trans.order() );
+
+  // the partitions keep the transaction order
+  std::vector<sat::Solvable> installs;
+  std::vector<sat::Solvable> erases;
+  for ( const sat::Transaction::Step & step : trans )
+  {
+    switch ( step.stepType() )
+    {
+      case sat::Transaction::TRANSACTION_INSTALL:
+      case sat::Transaction::TRANSACTION_MULTIINSTALL:
+        installs.push_back( step.satSolvable() );
+        break;
+      case sat::Transaction::TRANSACTION_ERASE:
+        erases.push_back( step.satSolvable() );
+        break;
+      case sat::Transaction::TRANSACTION_IGNORE:
+        break;
+    }
+  }
+  BOOST_CHECK( collect( trans.installSteps() ) == installs );
+  BOOST_CHECK( collect( trans.eraseSteps() ) == erases );
+  BOOST_CHECK( contains( installs, Ap ) );
+  BOOST_CHECK( contains( erases, Ig ) );
+  BOOST_CHECK( contains( collect( trans.mediaSteps( Ap.satSolvable().mediaNr() ) ), Ap ) );
+  BOOST_CHECK( collect( trans.mediaSteps( 42 ) ).empty() );
+
+  // step lookup and stages
+  BOOST_CHECK( trans.find( Apfr ) == trans.end() );
+  sat::Transaction::iterator it { trans.find( Ap ) };
+  BOOST_REQUIRE( it != trans.end() );
+  BOOST_CHECK_EQUAL( (*it).satSolvable(), Ap.satSolvable() );
+  BOOST_CHECK_EQUAL( (*it).stepStage(), sat::Transaction::STEP_TODO );
+  (*it).stepStage( sat::Transaction::STEP_DONE );
+  BOOST_CHECK_EQUAL( (*trans.find( Ap )).stepStage(), sat::Transaction::STEP_DONE );
+  BOOST_CHECK_EQUAL( trans.actionSize( sat::Transaction::STEP_DONE ), 1 );
+  BOOST_CHECK_EQUAL( trans.actionSize( sat::Transaction::STEP_TODO ), installs.size() + erases.size() - 1 );
+}
@@ -0,0 +1,100 @@
+#include <vector>
+#include <boost/test/unit_test.hpp>
+
+#include <zypp/Changelog.h>
+
+using namespace zypp;
+
+namespace
+{
+  struct VectorSource : public ChangelogView::Source
+  {
+    struct Entry { time_t date; std::string author; std::string text; };
+
+    VectorSource( std::vector<Entry> entries_r )
+    : _entries( std::move(entries_r) )
+    {}
+
+    unsigned size() const override
+    { return _entries.size(); }
+    Date date( unsigned idx_r ) const override
+    { return _entries[idx_r].date; }
+    std::string_view author( unsigned idx_r ) const override
+    { return _entries[idx_r].author; }
+    std::string_view text( unsigned idx_r ) const override
+    { return _entries[idx_r].text; }
+
+    std::vector<Entry> _entries;
+  };
+
+  ChangelogView testView()
+  {
+    return ChangelogView( std::make_shared<VectorSource>( std::vector<VectorSource::Entry> {
+      { 400, "Jane <jane@example.com> - 2.0-1", "- update to 2.0" },
+      { 300, "John <john@example.com>",         "- fix build" },
+      { 200, "Jane <jane@example.com> - 1.1",   "- update to 1.1" },
+      { 100, "John <john@example.com> - 1.0-1", "- initial package" },
+    } ) );
+  }
+
+  unsigned count( const ChangelogView & view_r )
+  {
+    unsigned ret = 0;
+    for ( auto it = view_r.begin(); it != view_r.end(); ++it )
+      ++ret;
+    return ret;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(changelogview_empty)
+{
+  ChangelogView view;
+  BOOST_CHECK( view.empty() );
+  BOOST_CHECK( view.begin() == view.end() );
+  BOOST_CHECK( view.asChangelog().empty() );
+}
+
+BOOST_AUTO_TEST_CASE(changelogview_all)
+{
+  ChangelogView view { testView() };
+  BOOST_CHECK( ! view.empty() );
+  BOOST_CHECK_EQUAL( count( view ), 4 );
+
+  Changelog changelog { view.asChangelog() };
+  BOOST_REQUIRE_EQUAL( changelog.size(), 4 );
+  BOOST_CHECK_EQUAL( changelog.front().date(), Date(400) );
+  BOOST_CHECK_EQUAL( changelog.front().author(), "Jane <jane@example.com> - 2.0-1" );
+  BOOST_CHECK_EQUAL( changelog.back().text(), "- initial package" );
+
+  auto it = view.begin();
+  BOOST_CHECK_EQUAL( it.author(), "Jane <jane@example.com> - 2.0-1" );
+  BOOST_CHECK_EQUAL( (*it).text(), "- update to 2.0" );
+}
+
+BOOST_AUTO_TEST_CASE(changelogview_stop)
+{
+  ChangelogView view { testView() };
+
+  BOOST_CHECK_EQUAL( count( view.stopAtDate( 300 ) ), 1 );
+  BOOST_CHECK_EQUAL( count( view.stopAtDate( 250 ) ), 2 );
+  BOOST_CHECK_EQUAL( count( view.stopAtDate( 500 ) ), 0 );
+  BOOST_CHECK( view.stopAtDate( 500 ).empty() );
+
+  // entries without version don't stop; missing release matches any
+  BOOST_CHECK_EQUAL( count( view.stopAtVersion( Edition("1.1-3") ) ), 2 );
+  BOOST_CHECK_EQUAL( count( view.stopAtVersion( Edition("1.0-1") ) ), 3 );
+  BOOST_CHECK_EQUAL( count( view.stopAtVersion( Edition("2.0-1") ) ), 0 );
+  BOOST_CHECK_EQUAL( count( view.stopAtVersion( Edition("0.9") ) ), 4 );
+}
+
+BOOST_AUTO_TEST_CASE(changelogview_iterator_outlives_view)
+{
+  // the temporary views are gone, the iterators keep data and stop criteria
+  auto it  = testView().stopAtDate( 250 ).begin();
+  auto end = testView().end();
+  BOOST_CHECK_EQUAL( it.author(), "Jane <jane@example.com> - 2.0-1" );
+  ++it;
+  BOOST_CHECK_EQUAL( it.text(), "- fix build" );
+  ++it;
+  BOOST_CHECK( it == end );
+}
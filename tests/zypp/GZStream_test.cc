@@ -78,3 +78,31 @@ BOOST_AUTO_TEST_CASE(gz_seek)
     BOOST_REQUIRE_EQUAL( test, "Hello" );
   }
 }
+
+BOOST_AUTO_TEST_CASE(gz_seek_cur_beyond_buffer)
+{
+  const zypp::Pathname file = zypp::Pathname(TESTS_BUILD_DIR) / "testseekcur.gz";
+  {
+    zypp::ofgzstream strOut( file.c_str() );
+    BOOST_REQUIRE( strOut.is_open() );
+    for ( unsigned i = 0; i < 4; ++i )
+      strOut << std::string( 512, 'a'+i );
+  }
+
+  // relative seeks leaving the read buffer must be relative to the current position
+  {
+    zypp::ifgzstream str( file.c_str() );
+    char buf[512];
+    str.read( buf, 512 );
+    str.seekg( 512, std::ios_base::cur );
+    BOOST_REQUIRE ( !str.fail() );
+    BOOST_REQUIRE_EQUAL( str.tellg(), 1024 );
+    str.read( buf, 512 );
+    BOOST_REQUIRE_EQUAL( buf[0], 'c' );
+    str.seekg( -1024, std::ios_base::cur );
+    BOOST_REQUIRE ( !str.fail() );
+    BOOST_REQUIRE_EQUAL( str.tellg(), 512 );
+    str.read( buf, 1 );
+    BOOST_REQUIRE_EQUAL( buf[0], 'b' );
+  }
+}
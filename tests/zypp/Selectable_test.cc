@@ -352,3 +352,150 @@ BOOST_AUTO_TEST_CASE(pickstatus_cycle)
 }
 
 /////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE(pool_transacting)
+{
+  ResPool pool( test.pool() );
+  BOOST_REQUIRE_EQUAL( pool.transactingSize(), 0 );
+
+  std::vector<PoolItem> items;
+  for ( const PoolItem & pi : pool.byKind<Package>() )
+  {
+    if ( ! pi.status().isInstalled() )
+      items.push_back( pi );
+    if ( items.size() == 3 )
+      break;
+  }
+  BOOST_REQUIRE_EQUAL( items.size(), 3 );
+
+  // 'may' queries leave no trace
+  BOOST_CHECK( items[0].status().maySetTransact( true, ResStatus::USER ) );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 0 );
+
+  items[0].status().setTransact( true, ResStatus::USER );
+  items[1].status().setTransact( true, ResStatus::USER );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 2 );
+  BOOST_CHECK_EQUAL( pool.transactingSize( ResKind::package ), 2 );
+  BOOST_CHECK_EQUAL( pool.transactingSize( ResKind::pattern ), 0 );
+  BOOST_CHECK_EQUAL( pool.transacting<Package>()[0], items[0] );
+
+  // assignment (e.g. restoring a saved status) is tracked
+  ResStatus saved( items[2].status() );
+  items[2].status() = items[0].status();
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 3 );
+  items[2].status() = saved;
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 2 );
+
+  // copies are not tracked
+  ResStatus copy( items[0].status() );
+  copy.resetTransact( ResStatus::USER );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 2 );
+
+  for ( const PoolItem & pi : pool.transacting() )
+    pi.status().resetTransact( ResStatus::USER );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 0 );
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE(pool_savestate)
+{
+  ResPool pool( test.pool() );
+  ResPoolProxy poolProxy( test.poolProxy() );
+
+  PoolItem item;
+  for ( const PoolItem & pi : pool.byKind<Package>() )
+  {
+    if ( ! pi.status().isInstalled() )
+    { item = pi; break; }
+  }
+  BOOST_REQUIRE( item );
+  const ResStatus orig( item.status() );
+
+  poolProxy.saveState();
+  BOOST_CHECK( ! poolProxy.diffState() );
+
+  item.status().setTransact( true, ResStatus::USER );
+  item.status().setRecommended( true );
+  BOOST_CHECK( poolProxy.diffState() );
+  BOOST_CHECK( poolProxy.diffState<Package>() );
+  BOOST_CHECK( ! poolProxy.diffState<Pattern>() );
+
+  poolProxy.restoreState();
+  BOOST_CHECK_EQUAL( item.status(), orig );
+  BOOST_CHECK( ! poolProxy.diffState() );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 0 );
+
+  // saved state stays valid after restore
+  item.status().setTransact( true, ResStatus::USER );
+  poolProxy.restoreState<Package>();
+  BOOST_CHECK_EQUAL( item.status(), orig );
+
+  // without a saved state just the transact state is tracked
+  poolProxy.discardState();
+  BOOST_CHECK( ! resstatus::trackAllChanges );
+  item.status().setTransact( true, ResStatus::USER );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 1 );
+  BOOST_CHECK( ! poolProxy.diffState() );
+  item.status().resetTransact( ResStatus::USER );
+  BOOST_CHECK_EQUAL( item.status(), orig );
+
+  // a scoped save ends with the scope
+  {
+    auto guard { poolProxy.scopedSaveState( ResKind::package ) };
+    BOOST_CHECK( resstatus::trackAllChanges );
+    item.status().setTransact( true, ResStatus::USER );
+    BOOST_CHECK( ! poolProxy.diffState<Package>() );	// independent of saveState
+  }
+  BOOST_CHECK_EQUAL( item.status(), orig );
+  BOOST_CHECK( ! resstatus::trackAllChanges );
+}
+
+BOOST_AUTO_TEST_CASE(pool_savestate_nested)
+{
+  ResPool pool( test.pool() );
+  ResPoolProxy poolProxy( test.poolProxy() );
+
+  std::vector<PoolItem> items;
+  for ( const PoolItem & pi : pool.byKind<Package>() )
+  {
+    if ( ! pi.status().isInstalled() )
+      items.push_back( pi );
+    if ( items.size() == 2 )
+      break;
+  }
+  BOOST_REQUIRE_EQUAL( items.size(), 2 );
+  const ResStatus orig0( items[0].status() );
+  const ResStatus orig1( items[1].status() );
+
+  poolProxy.saveState();
+  items[0].status().setTransact( true, ResStatus::USER );
+  const ResStatus outer0( items[0].status() );
+  {
+    // restored when leaving the scope
+    auto guard { poolProxy.scopedSaveState() };
+    items[0].status().resetTransact( ResStatus::USER );
+    items[1].status().setTransact( true, ResStatus::USER );
+  }
+  BOOST_CHECK_EQUAL( items[0].status(), outer0 );
+  BOOST_CHECK_EQUAL( items[1].status(), orig1 );
+  {
+    // accepted, a per kind save does not drop the outer saved values
+    auto guard { poolProxy.scopedSaveState( ResKind::package ) };
+    items[1].status().setTransact( true, ResStatus::USER );
+    guard.acceptState();
+  }
+  BOOST_CHECK( resstatus::trackAllChanges );
+  BOOST_CHECK( poolProxy.diffState() );
+
+  // the outer save still restores both items
+  poolProxy.restoreState();
+  BOOST_CHECK_EQUAL( items[0].status(), orig0 );
+  BOOST_CHECK_EQUAL( items[1].status(), orig1 );
+  BOOST_CHECK( ! poolProxy.diffState() );
+  poolProxy.discardState();
+  BOOST_CHECK( ! resstatus::trackAllChanges );
+  BOOST_CHECK_EQUAL( pool.transactingSize(), 0 );
+}
+
+/////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+#include "TestSetup.h"
+#include <zypp/ResPool.h>
+#include <zypp/Resolver.h>
+#include <zypp/SrcPackage.h>
+#include <zypp/ng/workflows/contextfacade.h>
+#include <zypp/ng/workflows/srcpackagewf.h>
+
+#define BOOST_TEST_MODULE SrcPackageWorkflow
+
+/////////////////////////////////////////////////////////////////////////////
+
+static TestSetup test( TestSetup::initLater );
+struct TestInit {
+  TestInit() {
+    test = TestSetup( Arch_x86_64 );
+    test.loadRepo( TESTS_SRC_DIR"/zypp/data/SrcPackageWorkflow", "SrcPackageWorkflow" );
+  }
+  ~TestInit() { test.reset(); }
+};
+BOOST_GLOBAL_FIXTURE( TestInit );
+
+namespace
+{
+  SrcPackage_constPtr srcPackage( const std::string & name_r )
+  {
+    for ( const PoolItem & pi : test.pool().byIdent( ResKind::srcpackage, name_r ) )
+      return asKind<SrcPackage>( pi );
+    return nullptr;
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+
+BOOST_AUTO_TEST_CASE(unresolvable_buildrequires)
+{
+  std::vector<SrcPackage_constPtr> srcPackages { srcPackage( "unbuildable" ) };
+  BOOST_REQUIRE( srcPackages[0] );
+
+  // a requirement the caller added before must survive
+  Resolver & resolver { test.resolver() };
+  resolver.addRequire( Capability( "gcc" ) );
+  const CapabilitySet before { resolver.getRequire() };
+
+  filesystem::TmpDir destDir;
+  auto ctx = zyppng::SyncContext::create();
+  auto res = zyppng::SrcPackageWorkflow::stageBuild( ctx, srcPackages, destDir.path() );
+
+  // 'doesnotexist' is not provided, the build requirements added are removed again
+  BOOST_CHECK( !res );
+  BOOST_CHECK( resolver.getRequire() == before );
+  resolver.removeRequire( Capability( "gcc" ) );
+}
+
+BOOST_AUTO_TEST_CASE(stage_build)
+{
+  // 'foo' requires gcc and make, 'bar' just gcc; 'foo' is requested twice
+  std::vector<SrcPackage_constPtr> srcPackages { srcPackage( "foo" ), srcPackage( "bar" ), srcPackage( "foo" ) };
+  BOOST_REQUIRE( srcPackages[0] && srcPackages[1] );
+
+  filesystem::TmpDir destDir;
+  auto ctx = zyppng::SyncContext::create();
+  auto res = zyppng::SrcPackageWorkflow::stageBuild( ctx, srcPackages, destDir.path() );
+  BOOST_REQUIRE( res );
+
+  // one file per requested source package, in the requested order
+  const auto & staged { res->_srcPackages };
+  BOOST_REQUIRE_EQUAL( staged.size(), 3 );
+  BOOST_CHECK_EQUAL( staged[0]->basename(), "foo-1-1.src.rpm" );
+  BOOST_CHECK_EQUAL( staged[1]->basename(), "bar-1-1.src.rpm" );
+  BOOST_CHECK_EQUAL( staged[2].value(), staged[0].value() );
+  for ( const auto & file : staged )
+  {
+    BOOST_CHECK( PathInfo( file ).isFile() );
+    BOOST_CHECK( file->dirname().asString().find( destDir.path().asString() ) == 0 );
+  }
+
+  // the shared build requirement is provided once
+  std::set<std::string> buildRequires;
+  for ( const auto & file : res->_buildRequires )
+  {
+    BOOST_CHECK( PathInfo( file ).isFile() );
+    buildRequires.insert( file->basename() );
+  }
+  BOOST_CHECK_EQUAL( res->_buildRequires.size(), 2 );
+  BOOST_CHECK( buildRequires == std::set<std::string>( { "gcc-1-1.x86_64.rpm", "make-1-1.x86_64.rpm" } ) );
+}
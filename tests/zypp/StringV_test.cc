@@ -2,6 +2,8 @@
 #include <iostream>
 #include <sstream>
 #include <optional>
+#include <vector>
+#include <zypp/base/String.h>
 #include <zypp/base/StringV.h>
 
 using std::cout;
@@ -234,3 +236,85 @@ BOOST_AUTO_TEST_CASE(trimming)
   BOOST_CHECK_EQUAL(  trim(" \t1\t ", " "),  "\t1\t" );
   BOOST_CHECK_EQUAL(  trim(" \t1\t ", ""),  " \t1\t " );
 }
+
+BOOST_AUTO_TEST_CASE(splitEscapedResults)
+{
+  // Same results as str::splitEscaped
+  auto words = []( std::string_view line_r, std::string_view sep_r, bool withEmpty_r ) {
+    std::string ret;
+    unsigned cnt = splitEscaped( line_r, sep_r, withEmpty_r, [&ret]( std::string_view w ) { ret += "|"; ret += w; } );
+    return ret + "#" + std::to_string( cnt );
+  };
+  auto strWords = []( std::string_view line_r, std::string_view sep_r, bool withEmpty_r ) {
+    std::vector<std::string> w;
+    unsigned cnt = zypp::str::splitEscaped( std::string( line_r ), std::back_inserter( w ), std::string( sep_r ), withEmpty_r );
+    std::string ret;
+    for ( const auto & el : w )
+      ret += "|" + el;
+    return ret + "#" + std::to_string( cnt );
+  };
+
+  struct {
+    std::string_view line;
+    std::string_view sep;
+    bool withEmpty;
+    std::string_view expect;
+  } const cases[] = {
+    { "",    ":", true,	"|#1" },
+    { ":",   ":", true,	"||#2" },
+    { "a",   ":", true,	"|a#1" },
+    { ":a",  ":", true,	"||a#2" },
+    { "a:",  ":", true,	"|a|#2" },
+    { ":a:", ":", true,	"||a|#3" },
+    { ":a:", ":", false,	"|a#1" },
+    { "",    " \t", false,	"#0" },
+    { " \t ", " \t", false,	"#0" },
+    { "normal line", " \t", false,	"|normal|line#2" },
+    { "  normal \t line  ", " \t", false,	"|normal|line#2" },
+    { "escaped\\ line", " \t", false,	"|escaped line#1" },
+    { "\"quoted line\"", " \t", false,	"|quoted line#1" },
+    { "'quoted line'", " \t", false,	"|quoted line#1" },
+    { "\"escaped quote\\\"\"", " \t", false,	"|escaped quote\"#1" },
+    { "a\\|b|'c|d'|\"\"", "|", true,	"|a|b|c|d|#3" },
+    { "x'y z'\"w\" v", " ", false,	"|xy zw|v#2" },
+  };
+  for ( const auto & c : cases )
+  {
+    BOOST_CHECK_EQUAL( words( c.line, c.sep, c.withEmpty ), strWords( c.line, c.sep, c.withEmpty ) );
+    BOOST_CHECK_EQUAL( words( c.line, c.sep, c.withEmpty ), c.expect );
+  }
+
+  // last flag is set on the final word; stop at once if false is returned
+  std::string seen;
+  splitEscaped( "a 'b c' d", [&seen]( std::string_view w, unsigned i, bool last ) {
+    seen += std::to_string( i ) + std::string( w ) + ( last ? "L" : "" );
+  } );
+  BOOST_CHECK_EQUAL( seen, "0a1b c2dL" );
+  BOOST_CHECK_EQUAL( splitEscaped( "a b c", []( std::string_view w ) { return w != "b"; } ), 2 );
+}
+
+BOOST_AUTO_TEST_CASE(numbersAndWords)
+{
+  unsigned u = 7;
+  BOOST_CHECK( strtonum( std::string_view( "1234\0x", 6 ), u ) );
+  BOOST_CHECK_EQUAL( u, 1234 );
+  BOOST_CHECK( ! strtonum( "x", u ) );
+  BOOST_CHECK_EQUAL( u, 1234 );
+  BOOST_CHECK_EQUAL( strtonum<int>( " +42" ), 42 );
+  BOOST_CHECK_EQUAL( strtonum<int>( "-42" ), -42 );
+  BOOST_CHECK_EQUAL( strtonum<int>( "" ), 0 );
+  BOOST_CHECK_EQUAL( strtonum<unsigned>( "ff", 16 ), 255 );
+
+  std::string_view line { "  1 \t2 3" };
+  BOOST_CHECK_EQUAL( stripFirstWord( line, true ), "1" );
+  BOOST_CHECK_EQUAL( line, "2 3" );
+  BOOST_CHECK_EQUAL( stripFirstWord( line, false ), "2" );
+  BOOST_CHECK_EQUAL( stripFirstWord( line, false ), "3" );
+  BOOST_CHECK_EQUAL( line, "" );
+  line = " x";
+  BOOST_CHECK_EQUAL( stripFirstWord( line, false ), "" );
+  BOOST_CHECK_EQUAL( line, "x" );
+
+  BOOST_CHECK( hasSuffix( "foo.rpm", ".rpm" ) );
+  BOOST_CHECK( ! hasSuffix( "rpm", ".rpm" ) );
+}
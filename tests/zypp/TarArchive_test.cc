@@ -0,0 +1,95 @@
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include <zypp-core/fs/TarArchive.h>
+#include <zypp-core/fs/TmpPath.h>
+#include <zypp/base/Exception.h>
+
+using std::cout;
+using std::endl;
+using namespace zypp;
+using namespace zypp::filesystem;
+
+static const Pathname DATADIR( TESTS_SRC_DIR "/repo/RepoLicense/repo/repodata" );
+
+namespace
+{
+  /** Write an uncompressed archive holding a single header of \a type_r
+   * claiming \a size_r (octal) bytes of data, followed by \a data_r
+   * zero bytes.
+   */
+  Pathname bogusArchive( const TmpDir & dir_r, char type_r, const char * size_r, size_t data_r = 0 )
+  {
+    char block[512];
+    ::memset( block, 0, sizeof(block) );
+    ::strcpy( block, "bogus" );
+    ::strcpy( block+100, "0000644" );
+    ::strcpy( block+124, size_r );
+    block[156] = type_r;
+    ::memset( block+148, ' ', 8 );
+    unsigned sum = 0;
+    for ( unsigned char ch : block )
+      sum += ch;
+    ::snprintf( block+148, 8, "%06o", sum );
+
+    Pathname ret { dir_r.path()/"bogus.tar" };
+    std::ofstream out( ret.c_str(), std::ios_base::binary );
+    out.write( block, sizeof(block) );
+    out << std::string( data_r, '\0' );
+    ::memset( block, 0, sizeof(block) );
+    out.write( block, sizeof(block) );
+    out.write( block, sizeof(block) );
+    return ret;
+  }
+}
+
+BOOST_AUTO_TEST_CASE(tararchive_list)
+{
+  TarArchive tgz( DATADIR/"CHECKSUM-license-prod.tar.gz" );	// pax format
+  std::string names;
+  for ( const auto & member : tgz.members() )
+  {
+    BOOST_CHECK( member.isFile() );
+    names += member.name + " ";
+  }
+  BOOST_CHECK_EQUAL( names, "license.de.txt license.fr.txt license.txt " );
+  BOOST_CHECK( tgz.hasMember( "license.fr.txt" ) );
+  BOOST_CHECK( ! tgz.hasMember( "no-acceptance-needed" ) );
+
+  BOOST_CHECK( TarArchive( DATADIR/"CHECKSUM-license.tar.gz" ).hasMember( "no-acceptance-needed" ) );
+}
+
+BOOST_AUTO_TEST_CASE(tararchive_extract)
+{
+  TarArchive tgz( DATADIR/"CHECKSUM-license-prod.tar.gz" );
+  BOOST_CHECK_EQUAL( tgz.extract( "license.txt" ), "license default\n" );
+  BOOST_CHECK_EQUAL( tgz.extract( "license.fr.txt" ), "license fr\n" );
+  BOOST_CHECK_EQUAL( tgz.extract( "license.de.txt" ), "license de\n" );
+  BOOST_CHECK_THROW( tgz.extract( "license.es.txt" ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE(tararchive_bad)
+{
+  BOOST_CHECK_THROW( TarArchive( DATADIR/"nonexistent.tar.gz" ), Exception );
+  BOOST_CHECK_THROW( TarArchive( DATADIR/"repomd.xml" ), Exception );
+}
+
+BOOST_AUTO_TEST_CASE(tararchive_bad_size)
+{
+  // sizes exceeding the archive are rejected instead of allocating them
+  TmpDir dir;
+  BOOST_CHECK_THROW( TarArchive( bogusArchive( dir, '0', "77777777777" ) ), Exception );
+  TarArchive::clearCache();
+  BOOST_CHECK_THROW( TarArchive( bogusArchive( dir, 'L', "77777777777" ) ), Exception );
+  TarArchive::clearCache();
+  BOOST_CHECK_THROW( TarArchive( bogusArchive( dir, 'x', "00000010000" ) ), Exception );
+  TarArchive::clearCache();
+  // extended headers are read into memory and limited even if the data is there
+  BOOST_CHECK_THROW( TarArchive( bogusArchive( dir, 'x', "00004000001", 1024*1024+512 ) ), Exception );
+  TarArchive::clearCache();
+  BOOST_CHECK_NO_THROW( TarArchive( bogusArchive( dir, '0', "00000000000" ) ) );
+}
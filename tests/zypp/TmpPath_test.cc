@@ -0,0 +1,128 @@
+#include <unistd.h>
+#include <fstream>
+
+#include <boost/test/unit_test.hpp>
+
+#include <zypp/PathInfo.h>
+#include <zypp/TmpPath.h>
+
+using namespace zypp;
+using namespace zypp::filesystem;
+
+BOOST_AUTO_TEST_CASE(tmparena_entries)
+{
+  TmpDir root;
+  Pathname arenaPath;
+  {
+    TmpArena arena( root, "arena." );
+    BOOST_REQUIRE( arena );
+    arenaPath = arena.path();
+    BOOST_CHECK_EQUAL( arenaPath.dirname(), root.path() );
+    BOOST_CHECK( PathInfo( arenaPath ).isDir() );
+
+    Pathname f1 { arena.newFile( "f-" ) };
+    Pathname f2 { arena.newFile( "f-" ) };
+    Pathname d1 { arena.newDir() };
+    Pathname r1 { arena.reserveName( "f-" ) };
+    BOOST_CHECK( f1 != f2 );
+    BOOST_CHECK( r1 != f1 && r1 != f2 );
+    BOOST_CHECK_EQUAL( f1.dirname(), arenaPath );
+    BOOST_CHECK( PathInfo( f1 ).isFile() );
+    BOOST_CHECK_EQUAL( PathInfo( f1 ).perm() & 0777, 0600 );
+    BOOST_CHECK( PathInfo( d1 ).isDir() );
+    BOOST_CHECK( ! PathInfo( r1 ).isExist() );
+
+    std::ofstream( f1.c_str() ) << std::string( 8192, 'x' );
+    BOOST_CHECK( arena.diskUsage() >= ByteCount( 8192 ) );
+
+    TmpArena::Stats stats { arena.stats() };
+    BOOST_CHECK_EQUAL( stats._files, 2 );
+    BOOST_CHECK_EQUAL( stats._dirs, 1 );
+    BOOST_CHECK( stats._peakUsage >= ByteCount( 8192 ) );
+
+    arena.clear();
+    BOOST_CHECK( PathInfo( arenaPath ).isDir() );
+    BOOST_CHECK( ! PathInfo( f1 ).isExist() );
+    BOOST_CHECK( ! PathInfo( d1 ).isExist() );
+    BOOST_CHECK_EQUAL( arena.stats()._cleanups, 1 );
+
+    // names are not reused after a cleanup
+    BOOST_CHECK( arena.newFile( "f-" ) != f1 );
+  }
+  BOOST_CHECK( ! PathInfo( arenaPath ).isExist() );
+}
+
+BOOST_AUTO_TEST_CASE(tmparena_anonymous_file)
+{
+  TmpDir root;
+  TmpArena arena( root );
+  Pathname target { root.path() / "target" };
+  std::ofstream( target.c_str() ) << "old";
+
+  {
+    // dropped without commit: target unchanged, nothing left in the arena
+    TmpArena::AnonymousFile file { arena.newAnonymousFile() };
+    BOOST_REQUIRE( file );
+    BOOST_CHECK_EQUAL( ::write( file.fd(), "bad", 3 ), 3 );
+  }
+  BOOST_CHECK_EQUAL( PathInfo( target ).size(), 3 );
+  BOOST_CHECK_EQUAL( arena.diskUsage(), ByteCount() );
+
+  TmpArena::AnonymousFile file { arena.newAnonymousFile() };
+  BOOST_REQUIRE( file );
+  BOOST_CHECK_EQUAL( ::write( file.fd(), "new data", 8 ), 8 );
+  BOOST_CHECK_EQUAL( file.commit( target ), 0 );
+  BOOST_CHECK( ! file );
+  BOOST_CHECK_EQUAL( PathInfo( target ).size(), 8 );
+
+  TmpArena::Stats stats { arena.stats() };
+  BOOST_CHECK_EQUAL( stats._anonymous, 2 );
+  BOOST_CHECK_EQUAL( stats._committed, 1 );
+}
+
+BOOST_AUTO_TEST_CASE(tmparena_tmpfile)
+{
+  TmpDir root;
+  Pathname arenaPath;
+  Pathname filePath;
+  {
+    TmpPath file;
+    {
+      TmpArena arena( root );
+      arenaPath = arena.path();
+      file = arena.newTmpFile( "key-" );
+      filePath = file.path();
+      BOOST_REQUIRE( file );
+      BOOST_CHECK_EQUAL( filePath.dirname(), arenaPath );
+      BOOST_CHECK_EQUAL( arena.stats()._files, 1 );
+
+      // dropping a TmpFile removes just its entry
+      Pathname otherPath;
+      {
+        TmpFile other { arena.newTmpFile( "key-" ) };
+        otherPath = other.path();
+        BOOST_CHECK( PathInfo( otherPath ).isFile() );
+      }
+      BOOST_CHECK( ! PathInfo( otherPath ).isExist() );
+    }
+    // the TmpFile keeps the arena alive
+    BOOST_CHECK( PathInfo( filePath ).isFile() );
+  }
+  BOOST_CHECK( ! PathInfo( filePath ).isExist() );
+  BOOST_CHECK( ! PathInfo( arenaPath ).isExist() );
+}
+
+BOOST_AUTO_TEST_CASE(tmparena_track_peak_usage)
+{
+  TmpDir root;
+  TmpArena arena( root );
+  BOOST_CHECK( ! arena.trackPeakUsage() );
+  std::ofstream( arena.newFile().c_str() ) << std::string( 8192, 'x' );
+  arena.clear();
+  BOOST_CHECK_EQUAL( arena.stats()._peakUsage, ByteCount() );
+
+  arena.trackPeakUsage( true );
+  std::ofstream( arena.newFile().c_str() ) << std::string( 8192, 'x' );
+  arena.clear();
+  BOOST_CHECK( arena.stats()._peakUsage >= ByteCount( 8192 ) );
+}
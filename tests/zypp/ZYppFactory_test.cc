@@ -0,0 +1,38 @@
+#include <stdlib.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <zypp/ZYppFactory.h>
+#include <zypp/ZYpp.h>
+#include <zypp/TmpPath.h>
+
+using namespace zypp;
+
+BOOST_AUTO_TEST_CASE(lockmode_shared_then_exclusive)
+{
+  // keep the lock files out of the system (in case we run as root)
+  filesystem::TmpDir lockRoot;
+  ::setenv( "ZYPP_LOCKFILE_ROOT", lockRoot.path().c_str(), 1 );
+
+  {
+    ZYpp::Ptr z = getZYpp( ZYppFactory::LockMode::Shared );
+    BOOST_CHECK( ZYppFactory::lockMode() == ZYppFactory::LockMode::Shared );
+    BOOST_CHECK( ZYppFactory::readOnly() );
+  }
+  BOOST_REQUIRE( ! ZYppFactory::instance().haveZYpp() );
+
+  // the shared session must not leave the process read-only
+  {
+    ZYpp::Ptr z = getZYpp( ZYppFactory::LockMode::Exclusive );
+    BOOST_CHECK( ZYppFactory::lockMode() == ZYppFactory::LockMode::Exclusive );
+    BOOST_CHECK( ! ZYppFactory::readOnly() );
+  }
+  BOOST_REQUIRE( ! ZYppFactory::instance().haveZYpp() );
+
+  // and a shared session after the exclusive one is read-only again
+  {
+    ZYpp::Ptr z = getZYpp( ZYppFactory::LockMode::Shared );
+    BOOST_CHECK( ZYppFactory::readOnly() );
+  }
+  ::unsetenv( "ZYPP_LOCKFILE_ROOT" );
+}
@@ -292,6 +292,7 @@ BOOST_AUTO_TEST_CASE(operations)
     BOOST_CHECK_EQUAL(str::ltrim(" \t f \t ffo \t "), "f \t ffo \t ");
     BOOST_CHECK_EQUAL(str::rtrim(" \t f \t ffo \t "), " \t f \t ffo");
     BOOST_CHECK_EQUAL(str::trim(" \t f \t ffo \t "),  "f \t ffo");
+    BOOST_CHECK_EQUAL(str::trim("\r\f\v f\r\n"),  "f");
 
     // strip first
     {
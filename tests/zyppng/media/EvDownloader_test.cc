@@ -5,6 +5,7 @@
 #include <zypp-curl/ng/network/NetworkRequestError>
 #include <zypp-curl/ng/network/NetworkRequestDispatcher>
 #include <zypp-curl/ng/network/Request>
+#include <zypp-curl/ng/network/private/hostcapabilities_p.h>
 #include <zypp-media/auth/CredentialManager>
 #include <zypp/Digest.h>
 #include <zypp/TmpPath.h>
@@ -697,3 +698,64 @@ BOOST_DATA_TEST_CASE( dltest_auth, bdata::make( withSSL ), withSSL )
     BOOST_REQUIRE ( allStates == std::vector<zyppng::Download::State>({ zyppng::Download::InitialState, zyppng::Download::DlMetaLinkInfo, zyppng::Download::PrepareMulti, zyppng::Download::DlMetalink, zyppng::Download::Finished}) );
   }
 }
+
+BOOST_AUTO_TEST_CASE( host_capability_cache )
+{
+  zypp::filesystem::TmpDir cacheDir;
+  const zypp::Url url( "https://example.org:8080/repo/oss/x86_64/foo.rpm" );
+  {
+    zyppng::HostCapabilityCache cache( cacheDir.path() );
+    BOOST_REQUIRE( !cache.lookup( url ) );
+
+    cache.update( zypp::Url( "https://example.org:8080/repo/oss/repodata/repomd.xml" ), []( auto &caps ) {
+      caps._metalink = false;
+      caps._maxRanges = 63;
+    });
+    cache.update( zypp::Url( "https://example.org:8080/repo/foo.rpm" ), []( auto &caps ) {
+      caps._metalink = true;
+    });
+    // no entry for the dir, the closest parent is used
+    const auto caps = cache.lookup( url );
+    BOOST_REQUIRE( caps );
+    BOOST_REQUIRE( sameTriboolState( caps->_metalink, true ) );
+    BOOST_REQUIRE( zypp::indeterminate( caps->_ranges ) );
+    // different port means different host
+    BOOST_REQUIRE( !cache.lookup( zypp::Url( "https://example.org/repo/oss/x86_64/foo.rpm" ) ) );
+  }
+  {
+    // entries survive in the cache dir
+    zyppng::HostCapabilityCache cache( cacheDir.path() );
+    const auto caps = cache.lookup( zypp::Url( "https://example.org:8080/repo/oss/repodata/primary.xml.gz" ) );
+    BOOST_REQUIRE( caps );
+    BOOST_REQUIRE( sameTriboolState( caps->_metalink, false ) );
+    BOOST_REQUIRE_EQUAL( caps->_maxRanges, 63 );
+
+    // invalidating a file drops the entries of all its parents
+    cache.invalidate( zypp::Url( "https://example.org:8080/repo/oss/repodata/primary.xml.gz" ) );
+    BOOST_REQUIRE( !cache.lookup( url ) );
+  }
+  {
+    // the file is rewritten only if a value changes
+    const zypp::Pathname file { cacheDir.path() / "https_example.org_8080" };
+    zyppng::HostCapabilityCache cache( cacheDir.path() );
+    cache.update( url, []( auto &caps ) { caps._ranges = true; } );
+    BOOST_REQUIRE( zypp::PathInfo( file ).isFile() );
+    zypp::filesystem::unlink( file );
+    cache.update( url, []( auto &caps ) { caps._ranges = true; } );
+    BOOST_REQUIRE( !zypp::PathInfo( file ).isExist() );
+
+    // a failed range request is remembered in memory only
+    cache.update( url, []( auto &caps ) { caps._ranges = false; } );
+    BOOST_REQUIRE( sameTriboolState( cache.lookup( url )->_ranges, false ) );
+    zyppng::HostCapabilityCache reloaded( cacheDir.path() );
+    const auto caps = reloaded.lookup( url );
+    BOOST_REQUIRE( caps );
+    BOOST_REQUIRE( zypp::indeterminate( caps->_ranges ) );
+  }
+  {
+    // outdated entries are ignored
+    zyppng::HostCapabilityCache cache( cacheDir.path(), std::chrono::seconds( -1 ) );
+    cache.update( url, []( auto &caps ) { caps._metalink = true; } );
+    BOOST_REQUIRE( !cache.lookup( url ) );
+  }
+}
@@ -12,6 +12,7 @@
 #include <zypp/PathInfo.h>
 
 #include <iostream>
+#include <fstream>
 #include <thread>
 #include <chrono>
 
@@ -734,3 +735,195 @@ BOOST_DATA_TEST_CASE(nwdispatcher_multipart_many_chunks_dl, bdata::make( withSSL
   }
 }
 
+
+// Many requests writing stripes of one large file at once, like the metalink
+// downloader does. Also reports the time taken, to compare output backends.
+BOOST_DATA_TEST_CASE(nwdispatcher_multipart_shared_stripes, bdata::make( withSSL ), withSSL )
+{
+  auto ev = zyppng::EventLoop::create();
+  auto disp = std::make_shared<zyppng::NetworkRequestDispatcher>();
+  disp->sigQueueFinished().connect( [&ev]( const zyppng::NetworkRequestDispatcher& ){
+    ev->quit();
+  });
+
+  disp->run();
+
+  // 16MiB of data that differs in every block
+  zypp::filesystem::TmpDir webRoot;
+  const auto sourceFile = webRoot.path() / "large.bin";
+  const size_t fileSize = 16 * 1024 * 1024;
+  {
+    std::string data( fileSize, '\0' );
+    uint32_t state = 0x12345678;
+    for ( auto & c : data ) {
+      state = state * 1664525 + 1013904223;
+      c = static_cast<char>( state >> 24 );
+    }
+    std::ofstream( sourceFile.c_str() ) << data;
+  }
+
+  WebServer web( webRoot.path().c_str(), 10001, withSSL );
+  BOOST_REQUIRE( web.start() );
+
+  auto weburl = web.url();
+  weburl.setPathName("/large.bin");
+
+  zypp::filesystem::TmpFile targetFile;
+  const std::string sourceData = TestTools::readFile ( sourceFile );
+
+  const size_t stripes   = 16;
+  const size_t stripeLen = fileSize / stripes;
+  const size_t blockLen  = 256 * 1024;
+
+  std::vector<zyppng::NetworkRequest::Ptr> requests;
+  for ( size_t stripe = 0; stripe < stripes; ++stripe ) {
+    auto req = std::make_shared<zyppng::NetworkRequest>( weburl, targetFile.path(), zyppng::NetworkRequest::WriteShared );
+    req->transferSettings() = web.transferSettings();
+    req->setExpectedFileSize( fileSize );
+    for ( size_t off = stripe * stripeLen; off < ( stripe + 1 ) * stripeLen; off += blockLen ) {
+      zypp::Digest blockDigest;
+      BOOST_REQUIRE( blockDigest.create( zypp::Digest::sha1() ) );
+      blockDigest.update( sourceData.data() + off, blockLen );
+
+      std::optional<zypp::Digest> dig = zypp::Digest();
+      BOOST_REQUIRE( dig->create( zypp::Digest::sha1() ) );
+      req->addRequestRange( off, blockLen, std::move(dig), blockDigest.digestVector() );
+    }
+    requests.push_back( req );
+    disp->enqueue( req );
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  if ( disp->count () ) ev->run();
+  const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - start );
+  BOOST_TEST_MESSAGE( "Downloaded " << stripes << " stripes of " << zypp::ByteCount( fileSize ) << " in " << elapsed.count() << "ms" );
+
+  for ( const auto & req : requests )
+    BOOST_TEST_REQ_SUCCESS( req );
+
+  BOOST_REQUIRE( TestTools::readFile ( targetFile.path() ) == sourceData );
+
+  // a range download verified by the full file checksum
+  {
+    zypp::filesystem::TmpFile fullFile;
+    auto req = std::make_shared<zyppng::NetworkRequest>( weburl, fullFile.path() );
+    req->transferSettings() = web.transferSettings();
+    req->addRequestRange( 0, 0 );
+    BOOST_REQUIRE( req->setExpectedFileChecksum( zypp::CheckSum::sha1( zypp::filesystem::sha1sum( sourceFile ) ) ) );
+    disp->enqueue( req );
+    if ( disp->count () ) ev->run();
+    BOOST_TEST_REQ_SUCCESS( req );
+  }
+}
+
+BOOST_AUTO_TEST_CASE(nwdispatcher_coalesce_same_host)
+{
+  auto ev = zyppng::EventLoop::create();
+
+  WebServer web((zypp::Pathname(TESTS_SRC_DIR)/"data"/"dummywebroot").c_str(), 10001, false );
+  web.addRequestHandler("getData", WebServer::makeResponse("200 OK", "small file" ) );
+  BOOST_REQUIRE( web.start() );
+
+  auto disp = std::make_shared<zyppng::NetworkRequestDispatcher>();
+  disp->setMaximumConcurrentConnections( 1 );
+  disp->sigQueueFinished().connect( [&ev]( const zyppng::NetworkRequestDispatcher& ){
+    ev->quit();
+  });
+
+  std::vector<std::string> startedHosts;
+  disp->sigDownloadStarted().connect( [&startedHosts]( zyppng::NetworkRequestDispatcher &, zyppng::NetworkRequest &req ){
+    startedHosts.push_back( req.url().getHost() );
+  });
+  disp->run();
+
+  // the same server under two host names, enqueued alternating
+  const size_t perHost = 10;
+  zypp::filesystem::TmpDir targetDir;
+  std::vector<zyppng::NetworkRequest::Ptr> requests;
+  for ( size_t i = 0; i < perHost * 2; ++i ) {
+    zyppng::Url weburl( web.url() );
+    weburl.setPathName("/handler/getData");
+    if ( i % 2 )
+      weburl.setHost("127.0.0.1");
+
+    auto req = std::make_shared<zyppng::NetworkRequest>( weburl, targetDir.path() / zypp::str::numstring(i) );
+    req->transferSettings() = web.transferSettings();
+    requests.push_back( req );
+    disp->enqueue( req );
+  }
+
+  if ( disp->count () ) ev->run();
+
+  for ( const auto & req : requests )
+    BOOST_TEST_REQ_SUCCESS( req );
+
+  // each freed slot went to the next request to the same host
+  BOOST_REQUIRE_EQUAL( startedHosts.size(), perHost * 2 );
+  for ( size_t i = 0; i < startedHosts.size(); ++i )
+    BOOST_REQUIRE_EQUAL( startedHosts[i], ( i < perHost ? "localhost" : "127.0.0.1" ) );
+
+  const auto &stats = disp->statistics();
+  BOOST_REQUIRE_EQUAL( stats._started, perHost * 2 );
+  BOOST_REQUIRE_EQUAL( stats._coalesced, ( perHost - 1 ) * 2 );
+  BOOST_REQUIRE_EQUAL( stats._batches, 2 );
+  BOOST_REQUIRE_EQUAL( stats._maxBatchSize, perHost );
+  BOOST_REQUIRE( stats._reusedConnections > 0 );
+}
+
+BOOST_AUTO_TEST_CASE(nwdispatcher_coalesce_max_batch)
+{
+  auto ev = zyppng::EventLoop::create();
+
+  WebServer web((zypp::Pathname(TESTS_SRC_DIR)/"data"/"dummywebroot").c_str(), 10001, false );
+  web.addRequestHandler("getData", WebServer::makeResponse("200 OK", "small file" ) );
+  BOOST_REQUIRE( web.start() );
+
+  auto disp = std::make_shared<zyppng::NetworkRequestDispatcher>();
+  disp->setMaximumConcurrentConnections( 1 );
+  disp->setMaximumBatchSize( 4 );
+  disp->sigQueueFinished().connect( [&ev]( const zyppng::NetworkRequestDispatcher& ){
+    ev->quit();
+  });
+
+  std::vector<std::string> startedHosts;
+  disp->sigDownloadStarted().connect( [&startedHosts]( zyppng::NetworkRequestDispatcher &, zyppng::NetworkRequest &req ){
+    startedHosts.push_back( req.url().getHost() );
+  });
+  disp->run();
+
+  const size_t perHost = 10;
+  zypp::filesystem::TmpDir targetDir;
+  std::vector<zyppng::NetworkRequest::Ptr> requests;
+  for ( size_t i = 0; i < perHost * 2; ++i ) {
+    zyppng::Url weburl( web.url() );
+    weburl.setPathName("/handler/getData");
+    if ( i % 2 )
+      weburl.setHost("127.0.0.1");
+
+    auto req = std::make_shared<zyppng::NetworkRequest>( weburl, targetDir.path() / zypp::str::numstring(i) );
+    req->transferSettings() = web.transferSettings();
+    requests.push_back( req );
+    disp->enqueue( req );
+  }
+
+  if ( disp->count () ) ev->run();
+
+  for ( const auto & req : requests )
+    BOOST_TEST_REQ_SUCCESS( req );
+
+  // runs of at most 4 requests, then the head of the queue gets the slot
+  const std::vector<size_t> runs { 4, 4, 4, 4, 2, 2 };
+  BOOST_REQUIRE_EQUAL( startedHosts.size(), perHost * 2 );
+  size_t pos = 0;
+  for ( size_t run = 0; run < runs.size(); ++run ) {
+    for ( size_t i = 0; i < runs[run]; ++i, ++pos )
+      BOOST_REQUIRE_EQUAL( startedHosts[pos], ( run % 2 ? "127.0.0.1" : "localhost" ) );
+  }
+
+  const auto &stats = disp->statistics();
+  BOOST_REQUIRE_EQUAL( stats._started, perHost * 2 );
+  BOOST_REQUIRE_EQUAL( stats._coalesced, perHost * 2 - runs.size() );
+  BOOST_REQUIRE_EQUAL( stats._batches, runs.size() );
+  BOOST_REQUIRE_EQUAL( stats._maxBatchSize, 4 );
+  BOOST_REQUIRE_EQUAL( stats._batchesCapped, 4 );
+}
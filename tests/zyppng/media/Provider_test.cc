@@ -127,6 +127,100 @@ BOOST_AUTO_TEST_CASE( http_attach )
     ev->run();
 }
 
+BOOST_AUTO_TEST_CASE( http_attach_mirrors )
+{
+  using namespace zyppng::operators;
+
+  auto ev = zyppng::EventLoop::create ();
+
+  const auto &workerPath = zypp::Pathname ( TESTS_BUILD_DIR ).dirname() / "tools" / "workers";
+  const auto &webRoot    = zypp::Pathname ( TESTS_SRC_DIR ) / "zyppng" / "data" / "downloader";
+  zypp::filesystem::TmpDir provideRoot;
+
+  auto prov = zyppng::Provide::create ( provideRoot );
+  prov->setWorkerPath ( workerPath );
+  prov->start();
+
+  WebServer web( webRoot.c_str(), 10001, false );
+  BOOST_REQUIRE( web.start() );
+
+  // all mirrors are asked at once, a mirror without a media file is not used
+  // as long as an earlier mirror may still serve the medium
+  auto noMedium = web.url();
+  noMedium.setPathName( "/doesnotexist" );
+  const std::vector<zypp::Url> mirrors {
+    zypp::Url( "http://127.0.0.1:10002/" ),
+    web.url(),
+    noMedium
+  };
+
+  std::optional<zyppng::Provide::MediaHandle> media;
+  auto op = prov->attachMedia( mirrors, zyppng::ProvideMediaSpec( "OnlineMedia" )
+                                               .setMediaFile( webRoot / "media.1" / "media" )
+                                               .setMedianr(1) );
+
+  op->onReady([&]( zyppng::expected<zyppng::Provide::MediaHandle> &&res ){
+    ev->quit();
+    if ( res )
+      media = std::move(*res);
+  });
+
+  BOOST_REQUIRE( !op->isReady() );
+
+  if ( !op->isReady() )
+    ev->run();
+
+  BOOST_REQUIRE( media.has_value() );
+  BOOST_REQUIRE( !media->handle().empty() );
+  // the medium was found on the web root, not on the mirror without a media file
+  BOOST_REQUIRE_EQUAL( media->baseUrl().getPort(), web.url().getPort() );
+  BOOST_REQUIRE_EQUAL( zypp::Pathname( media->baseUrl().getPathName() ), zypp::Pathname("/") );
+}
+
+BOOST_AUTO_TEST_CASE( http_attach_mirrors_relaxed )
+{
+  using namespace zyppng::operators;
+
+  auto ev = zyppng::EventLoop::create ();
+
+  const auto &workerPath = zypp::Pathname ( TESTS_BUILD_DIR ).dirname() / "tools" / "workers";
+  const auto &webRoot    = zypp::Pathname ( TESTS_SRC_DIR ) / "zyppng" / "data" / "downloader";
+  zypp::filesystem::TmpDir provideRoot;
+
+  auto prov = zyppng::Provide::create ( provideRoot );
+  prov->setWorkerPath ( workerPath );
+  prov->start();
+
+  WebServer web( webRoot.c_str(), 10001, false );
+  BOOST_REQUIRE( web.start() );
+
+  // the medium is the only one, so once all earlier mirrors failed
+  // the first mirror without a media file is used
+  auto noMedium = web.url();
+  noMedium.setPathName( "/doesnotexist" );
+  const std::vector<zypp::Url> mirrors {
+    zypp::Url( "http://127.0.0.1:10002/" ),
+    noMedium
+  };
+
+  std::optional<zyppng::Provide::MediaHandle> media;
+  auto op = prov->attachMedia( mirrors, zyppng::ProvideMediaSpec( "OnlineMedia" )
+                                               .setMediaFile( webRoot / "media.1" / "media" )
+                                               .setMedianr(1) );
+
+  op->onReady([&]( zyppng::expected<zyppng::Provide::MediaHandle> &&res ){
+    ev->quit();
+    if ( res )
+      media = std::move(*res);
+  });
+
+  if ( !op->isReady() )
+    ev->run();
+
+  BOOST_REQUIRE( media.has_value() );
+  BOOST_REQUIRE_EQUAL( zypp::Pathname( media->baseUrl().getPathName() ), zypp::Pathname("/doesnotexist") );
+}
+
 BOOST_AUTO_TEST_CASE( http_attach_prov )
 {
   using namespace zyppng::operators;
@@ -5,18 +5,31 @@
 //   delta: "/path/to/delta1"
 // - url: "https://dlmirror.foo/file2"
 //   delta: "/path/to/file2"
+//
+// Completed files are recorded in a resume journal, a rerun skips them. The
+// provider backend downloads up to --concurrency files in parallel. A throughput
+// summary is printed at the end.
 
 
 #include <zypp/MediaSetAccess.h>
 #include <zypp/ZYppCallbacks.h>
 #include <zypp-core/ManagedFile.h>
 #include <zypp-core/fs/TmpPath.h>
+#include <zypp-core/zyppng/base/EventLoop>
+#include <zypp-core/zyppng/pipelines/Expected>
+#include <zypp-media/ng/Provide>
+#include <zypp-media/ng/ProvideSpec>
 #include <zypp-tui/application.h>
 #include <zypp-tui/output/Out.h>
 #include <yaml-cpp/yaml.h>
 
 #include <boost/program_options.hpp>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <map>
 
 namespace po = boost::program_options;
 
@@ -26,6 +39,90 @@ struct DLEntry {
   zypp::ByteCount _dlSize;
 };
 
+/// Outcome of a single download, used for the summary
+struct DLResult {
+  zypp::Url _url;
+  zypp::ByteCount _size;
+  double _seconds = 0.0;
+  bool _resumed = false;   //< skipped, already completed and verified by an earlier run
+  std::string _error;
+};
+
+///////////////////////////////////////////////////////////////////
+/// Remembers the completed downloads in the target directory, so an
+/// interrupted run can skip them. Each line holds the sha256 checksum,
+/// the size and the path of a completed file:
+/// \code
+///   <sha256> <size> <path>
+/// \endcode
+/// A file is skipped only if it is still present with the journaled
+/// size and checksum.
+class ResumeJournal
+{
+public:
+  ResumeJournal( zypp::Pathname file_r )
+  : _file( std::move(file_r) )
+  {
+    std::ifstream in( _file.c_str() );
+    for ( std::string line; std::getline( in, line ); ) {
+      // the path is the remainder of the line and may contain blanks
+      const auto sep1 = line.find( ' ' );
+      const auto sep2 = sep1 == std::string::npos ? sep1 : line.find( ' ', sep1+1 );
+      if ( sep2 == std::string::npos )
+        continue;
+      _done[line.substr( sep2+1 )] = { line.substr( 0, sep1 ), zypp::str::strtonum<off_t>( line.substr( sep1+1, sep2-sep1-1 ) ) };
+    }
+    _out.open( _file.c_str(), std::ios_base::app );
+  }
+
+  /** Whether \a path_r was completed earlier and \a localFile_r is still valid. */
+  bool isComplete( const zypp::Pathname & path_r, const zypp::Pathname & localFile_r ) const
+  {
+    auto it = _done.find( path_r.asString() );
+    if ( it == _done.end() )
+      return false;
+    const zypp::PathInfo pi( localFile_r );
+    return pi.isFile() && pi.size() == it->second.second
+           && zypp::filesystem::checksum( localFile_r, "sha256" ) == it->second.first;
+  }
+
+  void markComplete( const zypp::Pathname & path_r, const zypp::Pathname & localFile_r )
+  {
+    // flushed per line, so an interrupted run keeps what was completed
+    _out << zypp::filesystem::checksum( localFile_r, "sha256" ) << ' ' << zypp::PathInfo( localFile_r ).size() << ' ' << path_r << std::endl;
+  }
+
+private:
+  zypp::Pathname _file;
+  std::map<std::string, std::pair<std::string, off_t>> _done;
+  std::ofstream _out;
+};
+
+/// Print the per file throughput and totals, \a wallSeconds is the time all downloads took
+void writeSummary( std::ostream & out, const std::vector<DLResult> & results, double wallSeconds )
+{
+  zypp::ByteCount total;
+  unsigned failed = 0, resumed = 0;
+  for ( const auto & r : results ) {
+    if ( !r._error.empty() ) {
+      ++failed;
+      out << "FAILED  " << r._url << ": " << r._error << "\n";
+      continue;
+    }
+    if ( r._resumed ) {
+      ++resumed;
+      out << "RESUMED " << r._url << "\n";
+      continue;
+    }
+    total += r._size;
+    out << "OK      " << r._url << " " << r._size << " in " << r._seconds << "s ("
+        << zypp::ByteCount( r._seconds > 0 ? (long long)( r._size / r._seconds ) : 0 ) << "/s)\n";
+  }
+  out << "Files: " << results.size() << " failed: " << failed << " resumed: " << resumed
+      << " downloaded: " << total << " in " << wallSeconds << "s ("
+      << zypp::ByteCount( wallSeconds > 0 ? (long long)( total / wallSeconds ) : 0 ) << "/s)" << std::endl;
+}
+
 // progress for downloading a file
 struct DownloadProgressReportReceiver : public zypp::callback::ReceiveReport<zypp::media::DownloadProgressReport>
 {
@@ -87,7 +184,10 @@ int main ( int argc, char *argv[] )
   visibleOptions.add_options()
     ("help", "produce help message")
     ("mediabackend" , po::value<std::string>()->default_value("legacy"), "Select the mediabackend to use, possible options: legacy, provider")
-    ("target-dir"   , po::value<std::string>()->default_value("."), "Directory where to download the files to." );
+    ("target-dir"   , po::value<std::string>()->default_value("."), "Directory where to download the files to." )
+    ("concurrency"  , po::value<unsigned>()->default_value(5), "Number of parallel downloads (provider backend)." )
+    ("journal"      , po::value<std::string>(), "Resume journal (default TARGETDIR/.download-journal). Files completed and verified by an earlier run are skipped." )
+    ("summary"      , po::value<std::string>(), "Also write the download summary to this file." );
 
   po::options_description positionalOpts;
   positionalOpts.add_options ()
@@ -206,23 +306,105 @@ int main ( int argc, char *argv[] )
     return 1;
   }
 
-  std::vector< zypp::ManagedFile > files;
-
   std::cout << "Using yaml: " << cFInfo.path() << "\n"
             << "Downloading to: " << targetDir.path ().realpath ()<< "\n"
             << "Using backend: " << vm["mediabackend"].as<std::string>() << "\n"
             << "Nr of downloads: " << entries.size() << "\n" << std::endl;
 
-  if ( vm["mediabackend"].as<std::string>() == "provider" ) {
-    std::cerr << "The provider support is not yet implemented, please try again later." << std::endl;
-    return 1;
+  const zypp::Pathname targetPath = targetDir.path().realpath();
+  ResumeJournal journal( vm.count("journal") ? zypp::Pathname( vm["journal"].as<std::string>() ) : targetPath / ".download-journal" );
+
+  std::vector<DLResult> results( entries.size() );
+  std::deque<size_t> pending;
+  for ( size_t i = 0; i < entries.size(); ++i ) {
+    const zypp::Pathname path( entries[i]._url.getPathName() );
+    results[i]._url = entries[i]._url;
+    if ( journal.isComplete( path, targetPath / path ) ) {
+      std::cout << "Already downloaded: " << entries[i]._url << std::endl;
+      results[i]._resumed = true;
+      continue;
+    }
+    pending.push_back( i );
   }
 
+  using Clock = std::chrono::steady_clock;
+  const auto secondsSince = []( Clock::time_point start ) {
+    return std::chrono::duration<double>( Clock::now() - start ).count();
+  };
+  const auto dlStart = Clock::now();
+
+  if ( vm["mediabackend"].as<std::string>() == "provider" ) {
+    using namespace zyppng::operators;
+
+    const unsigned concurrency = std::max( 1U, vm["concurrency"].as<unsigned>() );
+    auto ev = zyppng::EventLoop::create();
+    auto prov = zyppng::Provide::create();
+
+    std::vector<zyppng::AsyncOpRef<int>> running;
+    unsigned active = 0;
+
+    // keep at most 'concurrency' files in the provider queue
+    std::function<void()> startNext = [&]() {
+      while ( active < concurrency && !pending.empty() ) {
+        const size_t idx = pending.front();
+        pending.pop_front();
+        ++active;
+
+        const auto &e = entries[idx];
+        const zypp::Pathname path( e._url.getPathName() );
+        const zypp::Pathname localFile( targetPath / path );
+        const auto start = Clock::now();
+
+        running.push_back( prov->provide( e._url, zyppng::ProvideFileSpec()
+                                                    .setOptional( false )
+                                                    .setDeltafile( e._deltaFile )
+                                                    .setDownloadSize( e._dlSize ) )
+          | and_then( zyppng::Provide::copyResultToDest( prov, localFile ) )
+          | [&, idx, path, localFile, start]( zyppng::expected<zypp::ManagedFile> &&res ) {
+              DLResult &r = results[idx];
+              r._seconds = secondsSince( start );
+              if ( res ) {
+                res->resetDispose();
+                r._size = zypp::PathInfo( localFile ).size();
+                journal.markComplete( path, localFile );
+                std::cout << "File downloaded: " << r._url << std::endl;
+              } else {
+                try {
+                  std::rethrow_exception( res.error() );
+                } catch ( const zypp::Exception &ex ) {
+                  r._error = ex.asUserString();
+                } catch ( const std::exception &ex ) {
+                  r._error = ex.what();
+                } catch ( ... ) {
+                  r._error = "Unknown error";
+                }
+                std::cerr << "Failed to download file: " << r._url << ": " << r._error << std::endl;
+              }
+
+              --active;
+              if ( pending.empty() && active == 0 )
+                ev->quit();
+              else
+                startNext();
+              return 0;
+            } );
+      }
+    };
+
+    if ( !pending.empty() ) {
+      prov->start();
+      startNext();
+      if ( active )
+        ev->run();
+    }
 
-  DownloadProgressReportReceiver receiver;
+  } else {
 
-  if ( entries.size() ) {
-    for ( const auto &e : entries ) {
+    DownloadProgressReportReceiver receiver;
+
+    for ( const size_t idx : pending ) {
+      const auto &e = entries[idx];
+      const auto start = Clock::now();
       try {
 
         zypp::Url url(e._url);
@@ -231,7 +413,7 @@ int main ( int argc, char *argv[] )
         url.setPathName ("/");
         zypp::MediaSetAccess access(url);
 
-        zypp::ManagedFile locFile( targetDir.path().realpath() / path, zypp::filesystem::unlink );
+        zypp::ManagedFile locFile( targetPath / path, zypp::filesystem::unlink );
         zypp::filesystem::assert_dir( locFile->dirname() );
 
         auto file = access.provideFile(
@@ -245,14 +427,26 @@ int main ( int argc, char *argv[] )
           ZYPP_THROW( zypp::Exception("Can't copy file from " + file.asString() + " to " +  locFile->asString() ));
 
         std::cout << "File downloaded: " << e._url << std::endl;
-        files.push_back ( locFile );
-
-      } catch ( const zypp::Exception &e ) {
-        std::cerr << "Failed to download file: " << e << std::endl;
+        results[idx]._seconds = secondsSince( start );
+        results[idx]._size = zypp::PathInfo( locFile ).size();
+        journal.markComplete( path, locFile );
+        locFile.resetDispose();
+
+      } catch ( const zypp::Exception &ex ) {
+        std::cerr << "Failed to download file: " << ex << std::endl;
+        results[idx]._error = ex.asUserString();
       }
     }
   }
 
+  const double wallSeconds = secondsSince( dlStart );
+  std::cout << std::endl;
+  writeSummary( std::cout, results, wallSeconds );
+  if ( vm.count("summary") ) {
+    std::ofstream summary( vm["summary"].as<std::string>() );
+    writeSummary( summary, results, wallSeconds );
+  }
+
   //std::cout << "Done, press any key to continue" << std::endl;
   //getchar();
   return 0;
@@ -15,10 +15,82 @@
 
 #include <cstdlib>
 #include <clocale>
+#include <fstream>
 #include <iostream>
+#include <map>
 #include <numeric>
 
 #include "output.h"
+#include "../argparse.h"
+
+static std::string appname { "repomirror" };
+
+///////////////////////////////////////////////////////////////////
+/// \brief State of an incrementally mirrored snapshot.
+///
+/// Remembers the checksum of each file mirrored into a snapshot
+/// directory. A file whose checksum in primary did not change since
+/// the last run is hardlinked from the previous snapshot rather than
+/// downloaded again.
+///
+/// The state file contains one line per file:
+/// \code
+///   <checksumtype>:<checksum> <filename>
+/// \endcode
+class MirrorState
+{
+public:
+  static constexpr const char * stateFile = ".mirror-state";
+
+  /** Read the state of snapshot \a dir_r (if any). */
+  void load( const zypp::Pathname & dir_r )
+  {
+    _dir = dir_r;
+    std::ifstream in( (dir_r/stateFile).c_str() );
+    for ( std::string line; std::getline( in, line ); ) {
+      std::string::size_type sep = line.find( ' ' );
+      if ( sep != std::string::npos )
+        _files[line.substr( sep+1 )] = line.substr( 0, sep );
+    }
+  }
+
+  /** The snapshot directory this state was loaded from. */
+  const zypp::Pathname & dir() const
+  { return _dir; }
+
+  /** Whether \a filename_r with \a checksum_r is present in the snapshot. */
+  bool contains( const std::string & filename_r, const zypp::CheckSum & checksum_r ) const
+  {
+    if ( checksum_r.empty() )
+      return false;
+    auto it = _files.find( filename_r );
+    return it != _files.end() && it->second == asString( checksum_r ) && zypp::PathInfo( _dir/filename_r ).isFile();
+  }
+
+  void add( const std::string & filename_r, const zypp::CheckSum & checksum_r )
+  {
+    if ( ! checksum_r.empty() )
+      _files[filename_r] = asString( checksum_r );
+  }
+
+  /** Write the state for all remembered files present in \a dir_r. */
+  bool save( const zypp::Pathname & dir_r ) const
+  {
+    std::ofstream out( (dir_r/stateFile).c_str() );
+    for ( const auto & [ filename, checksum ] : _files ) {
+      if ( zypp::PathInfo( dir_r/filename ).isFile() )
+        out << checksum << ' ' << filename << '\n';
+    }
+    return out.good();
+  }
+
+private:
+  static std::string asString( const zypp::CheckSum & checksum_r )
+  { return checksum_r.type() + ":" + checksum_r.checksum(); }
+
+  zypp::Pathname _dir;
+  std::map<std::string, std::string> _files;
+};
 
 class DlSkippedException : public zypp::Exception
 {
@@ -150,10 +222,65 @@ zyppng::AsyncOpRef<zyppng::expected<zyppng::ProvideRes>> checksumIfRequired ( st
 
 
 
+int usage( const argparse::Options & options_r, int return_r = 0 )
+{
+  std::cerr << "USAGE: " << appname << " [OPTION]..." << std::endl;
+  std::cerr << "    Mirror the packages of the selected repositories." << std::endl;
+  std::cerr << options_r << std::endl;
+  return return_r;
+}
+
 int main ( int argc, char *argv[] )
 {
   using namespace zyppng::operators;
 
+  appname = zypp::Pathname::basename( argv[0] );
+
+  argparse::Options options;
+  options.add()
+    ( "help,h",		"Print help and exit." )
+    ( "target",		"Mirror into directory TARGET (default ./allrpms).", argparse::Option::Arg::required )
+    ( "incremental",	"Mirror into a new snapshot of TARGET: only new or changed files are downloaded, "
+                        "unchanged files are hardlinked from the previous snapshot. TARGET is a symlink "
+                        "atomically switched to the new snapshot on success." )
+    ;
+
+  bool incremental = false;
+  zypp::Pathname target = zypp::Pathname(".").realpath() / "allrpms";
+  try {
+    auto result = options.parse( argc, argv );
+    if ( result.count( "help" ) )
+      return usage( options );
+    if ( result.count( "target" ) )
+      target = zypp::Pathname( result["target"].arg() ).absolutename();
+    incremental = result.count( "incremental" );
+  }
+  catch ( const argparse::OptionException & e ) {
+    std::cerr << e.what() << std::endl;
+    return usage( options, 1 );
+  }
+
+  MirrorState prevState;	// incremental: the previous snapshot
+  MirrorState newState;
+  zypp::Pathname workPath = target;
+  if ( incremental ) {
+    zypp::PathInfo pi( target, zypp::PathInfo::LSTAT );
+    if ( pi.isExist() && ! pi.isLink() ) {
+      std::cerr << target << " exists and is not a symlink to a snapshot." << std::endl;
+      return 1;
+    }
+    if ( pi.isLink() ) {
+      // the link is written relative to the targets directory
+      zypp::Pathname prevDir { zypp::filesystem::readlink( target ) };
+      if ( prevDir.relative() )
+        prevDir = target.dirname() / prevDir;
+      prevState.load( prevDir );
+    }
+
+    workPath = target.dirname() / ( target.basename() + "." + zypp::Date::now().form( "%Y%m%d%H%M%S" ) );
+  }
+  zypp::filesystem::assert_dir( workPath );
+
   auto ev = zyppng::EventLoop::create();
 
   auto output = OutputView::create();
@@ -270,9 +397,7 @@ int main ( int argc, char *argv[] )
   // we need a way to remember the data for the full transaction, there is probably a better way for a real application
   std::unordered_map<int, std::unordered_map<int, std::vector<zypp::sat::Solvable>>> repoToMediaToSolvables;
 
-  zypp::Pathname workPath = zypp::Pathname(".").realpath() / "allrpms";
-  zypp::filesystem::assert_dir( workPath );
-
+  int reused = 0;
   for ( const auto repoToDl : reposToDl ) {
     const auto &r = myRepos[repoToDl];
     output->putMsgTxt( zypp::str::Str() << "Repo selected to download: " << r.asUserString() << "\n" );
@@ -296,6 +421,17 @@ int main ( int argc, char *argv[] )
     std::for_each( satPool.solvablesBegin(), satPool.solvablesEnd(), [&]( const zypp::sat::Solvable &s ) {
       if ( s.repository() != r )
         return;
+      if ( incremental && s.isKind<zypp::Package>() ) {
+        const auto &oml = s.lookupLocation();
+        const std::string &fName = oml.filename().basename();
+        newState.add( fName, oml.checksum() );
+        // unchanged since the previous snapshot: just hardlink it
+        if ( prevState.contains( fName, oml.checksum() )
+             && zypp::filesystem::hardlinkCopy( prevState.dir()/fName, workPath/fName ) == 0 ) {
+          reused++;
+          return;
+        }
+      }
       bc += s.downloadSize();
       const auto mediaNr = s.lookupLocation().medianr();
       mediaToSolvables[mediaNr].push_back(s);
@@ -398,7 +534,30 @@ int main ( int argc, char *argv[] )
   }
   #endif
 
-  output->putMsgTxt( zypp::str::Str() <<  "All done:\nSuccess:" << succ << "\nErrors: "<< err << "\nSkipped:"<<skip<<"\n", false );
+  if ( incremental ) {
+    if ( err ) {
+      output->putMsgErr( zypp::str::Str() << "Errors occurred, keeping the previous snapshot. Incomplete snapshot left in " << workPath << "\n" );
+    }
+    else if ( ! newState.save( workPath ) ) {
+      output->putMsgErr( zypp::str::Str() << "Failed to write the mirror state to " << workPath << "\n" );
+    }
+    else {
+      // Atomically switch the target symlink to the new snapshot.
+      zypp::Pathname tmpLink = target.extend( ".new" );
+      zypp::filesystem::unlink( tmpLink );
+      if ( zypp::filesystem::symlink( workPath.basename(), tmpLink ) != 0
+           || zypp::filesystem::rename( tmpLink, target ) != 0 ) {
+        output->putMsgErr( zypp::str::Str() << "Failed to switch " << target << " to " << workPath << "\n" );
+      }
+      else {
+        output->putMsgTxt( zypp::str::Str() << target << " now points to " << workPath << "\n" );
+        if ( ! prevState.dir().empty() && prevState.dir() != workPath )
+          zypp::filesystem::recursive_rmdir( prevState.dir() );
+      }
+    }
+  }
+
+  output->putMsgTxt( zypp::str::Str() <<  "All done:\nSuccess:" << succ << "\nReused: " << reused << "\nErrors: "<< err << "\nSkipped:"<<skip<<"\n", false );
   output->putMsgTxt( zypp::str::Str() <<  "Waiting, press Return to exit\n" );
   output->waitForKeys( { NCKEY_ENTER } );
   return 0;
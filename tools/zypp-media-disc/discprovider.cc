@@ -170,17 +170,27 @@ zyppng::worker::AttachResult DiscProvider::mountDevice ( const uint32_t id, cons
     // remember how many devices we were able to test
     uint devicesTested = 0;
 
+    // make sure the trays are closed and the drives are ready, probing them all at once
+    std::vector<std::string> freeNames;
+    for( const auto &dev : possibleDevs ) {
+      if ( dev->_mountPoint.empty() )
+        freeNames.push_back( dev->_name );
+    }
+    const auto &driveStatus = zypp::media::CDTools::probeDevices( freeNames );
+
     // none of the already mounted devices matched, lets try what we have left
+    auto status = driveStatus.begin();
     for( const auto &dev : possibleDevs ) {
       if ( !dev->_mountPoint.empty() )
         continue;
 
-      MIL << "Trying to mount dev " << dev->_name << std::endl;
-
-      // make sure the tray is closed
-      zypp::media::CDTools::closeTray( dev->_name );
-
       devicesTested++;
+      if ( !zypp::media::CDTools::mayHaveDisc( *(status++) ) ) {
+        MIL << "No disc in dev " << dev->_name << std::endl;
+        continue;
+      }
+
+      MIL << "Trying to mount dev " << dev->_name << std::endl;
       zypp::media::Mount mount;
       bool mountsucceeded = false;
       std::exception_ptr lastErr;
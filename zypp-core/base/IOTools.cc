@@ -175,9 +175,17 @@ namespace zypp::io {
 
     fflush( fd );
 
+    return peek_data_fd( fileno( fd ), offset, count );
+  }
+
+  std::vector<char> peek_data_fd( int fd, off_t offset, size_t count )
+  {
+    if ( fd == -1 )
+      return {};
+
     std::vector<char> data( count + 1 , '\0' );
 
-    ssize_t l = zyppng::eintrSafeCall( pread, fileno( fd ), data.data(), count, offset );
+    ssize_t l = zyppng::eintrSafeCall( pread, fd, data.data(), count, offset );
     if (l == -1)
       return {};
 
@@ -89,6 +89,11 @@ namespace zypp::io {
    * Fetches data from a FILE without changing the current file offset
    */
   std::vector<char> peek_data_fd ( FILE *fd, off_t offset, size_t count );
+
+  /*!
+   * Fetches data from a file descriptor without changing the current file offset
+   */
+  std::vector<char> peek_data_fd ( int fd, off_t offset, size_t count );
 }
 
 #endif
@@ -233,7 +233,7 @@ namespace zypp
 
       if ( trim_r & L_TRIM )
       {
-        std::string::size_type p = ret.find_first_not_of( " \t\n" );
+        std::string::size_type p = ret.find_first_not_of( whitespace );
         if ( p == std::string::npos )
         {
           ret.clear();
@@ -244,7 +244,7 @@ namespace zypp
 
       if ( trim_r & R_TRIM )
       {
-        std::string::size_type p = ret.find_last_not_of( " \t\n" );
+        std::string::size_type p = ret.find_last_not_of( whitespace );
         if ( p == std::string::npos )
         {
           ret.clear();
@@ -500,6 +500,9 @@ namespace zypp
       TRIM    = (L_TRIM|R_TRIM)
     };
 
+    /** The whitespace removed by \ref trim (like \c isspace in the "C" locale). */
+    inline constexpr const char * whitespace = " \t\n\r\f\v";
+
     std::string trim( const std::string & s, const Trim trim_r = TRIM ) ZYPP_API;
     std::string trim( std::string && s, const Trim trim_r = TRIM ) ZYPP_API;
 
@@ -9,6 +9,7 @@
 /** \file zypp/base/StringV.cc
  */
 #include <iostream>
+#include <optional>
 #include <zypp-core/base/StringV.h>
 
 ///////////////////////////////////////////////////////////////////
@@ -183,6 +184,138 @@ namespace zypp
       return fncCall;
     }
 
+    unsigned detail::_splitEscaped( std::string_view line_r, std::string_view sepchars_r, bool withEmpty_r, const WordConsumer & fnc_r )
+    {
+      // callback stats
+      bool fncStop = false;
+      unsigned fncCall = 0;
+
+      // For the 'last' CB argument: we must remember a word until we know
+      // whether another one is following. Unescaped words are built in one
+      // of two buffers, alternating, so the remembered word stays intact.
+      std::string buffers[2];
+      unsigned bufidx = 0;
+      std::optional<std::string_view> pending;
+
+      auto report = [&]( std::string_view word_r )->bool {
+        if ( pending ) {
+          if ( fnc_r && ! fnc_r( *pending, fncCall, false/*more to come*/ ) )
+            fncStop = true;
+          ++fncCall;
+        }
+        pending = fncStop ? std::nullopt : std::optional<std::string_view>( word_r );
+        return ! fncStop;
+      };
+
+      auto isSep = [&sepchars_r]( char ch )->bool { return sepchars_r.find( ch ) != std::string_view::npos; };
+
+      // NOTE: line_r is not null-terminated!
+      const char *const eol = line_r.data() + line_r.size();
+      const char * cur = line_r.data();
+
+      // skip leading sepchars
+      while ( ! fncStop && cur < eol && isSep( *cur ) ) {
+        ++cur;
+        if ( withEmpty_r )
+          report( std::string_view() );
+      }
+
+      // there were only sepchars in the string
+      if ( ! fncStop && cur == eol && withEmpty_r )
+        report( std::string_view() );
+
+      // after the leading sepchars
+      enum class Quote { None, Slash, Single, Double, DoubleSlash };
+      for ( const char * beg = cur; ! fncStop && beg < eol; beg = cur )
+      {
+        // read next value until unquoted sepchar
+        std::string * buf = nullptr;	// as long as there's nothing to unescape, the word is a view into line_r
+        Quote quoting = Quote::None;
+        do {
+          const char ch = *cur;
+          if ( ! buf && ( ch == '\\' || ch == '\'' || ch == '"' ) ) {
+            buf = &buffers[bufidx];
+            buf->assign( beg, cur-beg );
+          }
+          switch ( quoting )
+          {
+            case Quote::None:
+              switch ( ch )
+              {
+                case '\\':	quoting = Quote::Slash;		break;
+                case '\'':	quoting = Quote::Single;	break;
+                case '"':	quoting = Quote::Double;	break;
+                default:	if ( buf ) buf->push_back( ch );	break;
+              }
+              break;
+
+            case Quote::Slash:
+              buf->push_back( ch );
+              quoting = Quote::None;
+              break;
+
+            case Quote::Single:
+              switch ( ch )
+              {
+                case '\'':	quoting = Quote::None;		break;
+                default:	buf->push_back( ch );		break;
+              }
+              break;
+
+            case Quote::Double:
+              switch ( ch )
+              {
+                case '"':	quoting = Quote::None;		break;
+                case '\\':	quoting = Quote::DoubleSlash;	break;
+                default:	buf->push_back( ch );		break;
+              }
+              break;
+
+            case Quote::DoubleSlash:
+              switch ( ch )
+              {
+                case '"':	/*fallthrough*/
+                case '\\':	buf->push_back( ch );		break;
+                default:
+                  buf->push_back( '\\' );
+                  buf->push_back( ch );
+                  break;
+              }
+              quoting = Quote::Double;
+              break;
+          }
+          ++cur;
+        } while ( cur < eol && ( quoting != Quote::None || ! isSep( *cur ) ) );
+
+        if ( buf ) {
+          report( *buf );
+          bufidx ^= 1;
+        }
+        else
+          report( std::string_view( beg, cur-beg ) );
+
+        // skip sepchars
+        if ( cur < eol && isSep( *cur ) )
+          ++cur;
+        while ( ! fncStop && cur < eol && isSep( *cur ) ) {
+          ++cur;
+          if ( withEmpty_r )
+            report( std::string_view() );
+        }
+        // the last was a separator => one more field
+        if ( ! fncStop && cur == eol && withEmpty_r && isSep( *(cur-1) ) )
+          report( std::string_view() );
+      }
+
+      // finally report the last word
+      if ( pending ) {
+        if ( fnc_r )
+          fnc_r( *pending, fncCall, true/*last*/ );
+        ++fncCall;
+      }
+      return fncCall;
+    }
+
   } // namespace strv
 } // namespace zypp
 ///////////////////////////////////////////////////////////////////
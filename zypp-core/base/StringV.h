@@ -14,6 +14,7 @@
 #include <string_view>
 #ifdef __cpp_lib_string_view
 
+#include <charconv>
 #include <zypp-core/Globals.h>
 #include <zypp-core/base/String.h>
 #include <zypp-core/base/Regex.h>
@@ -99,6 +100,68 @@ namespace zypp
     inline bool hasPrefixCI( std::string_view str_r, std::string_view prefix_r  )
     { return( ::strncasecmp( str_r.data(), prefix_r.data(), prefix_r.size()  ) == 0 ); }
 
+    /** Return whether \a str_r has suffix \a suffix_r. */
+    inline bool hasSuffix( std::string_view str_r, std::string_view suffix_r )
+    { return( str_r.size() >= suffix_r.size() && str_r.substr( str_r.size()-suffix_r.size() ) == suffix_r ); }
+
+    /** Strip the first word (delimited by blank) from \a line_r and return it.
+     * Like \ref str::stripFirstWord, but \a line_r is just a view which is moved
+     * behind the word (and left trimmed).
+     * \code
+     *   std::string_view line { "  1 2 3" };
+     *   stripFirstWord( line, true );	// "1", line is "2 3"
+     *   stripFirstWord( line, false );	// "2", line is "3"
+     * \endcode
+     */
+    inline std::string_view stripFirstWord( std::string_view & line_r, bool ltrim_first_r )
+    {
+      if ( ltrim_first_r )
+        line_r = ltrim( line_r );
+
+      std::string_view::size_type p = line_r.find_first_of( blank );
+      std::string_view ret { line_r.substr( 0, p ) };
+      line_r = p == line_r.npos ? line_r.substr( line_r.size() ) : ltrim( line_r.substr( p ) );
+      return ret;
+    }
+
+    /** Parsing numbers (via \c std::from_chars, so no locale, no allocation).
+     * Leading blanks and a \c '+' are skipped. Parsing stops at the first
+     * character not belonging to the number, like \c strtol does.
+     * \returns whether a number was parsed into \a num_r (\a num_r is not
+     * changed otherwise).
+     * \code
+     *   unsigned pid = 0;
+     *   if ( strtonum( "1234\0xyz", pid ) )
+     *     ...
+     * \endcode
+     */
+    template <typename TInt, std::enable_if_t<std::is_integral_v<TInt> && !std::is_same_v<TInt,bool>, bool> = true>
+    bool strtonum( std::string_view str_r, TInt & num_r, int base_r = 10 )
+    {
+      str_r = ltrim( str_r );
+      if ( ! str_r.empty() && str_r[0] == '+' )
+        str_r.remove_prefix( 1 );
+      TInt num {};
+      auto res { std::from_chars( str_r.data(), str_r.data()+str_r.size(), num, base_r ) };
+      if ( res.ec != std::errc() )
+        return false;
+      num_r = num;
+      return true;
+    }
+
+    /** \overload Returning the number (or \c 0 on error, like \ref str::strtonum).
+     * \code
+     *   time_t t = strtonum<time_t>( "42" );
+     * \endcode
+     */
+    template <typename TInt, std::enable_if_t<std::is_integral_v<TInt> && !std::is_same_v<TInt,bool>, bool> = true>
+    TInt strtonum( std::string_view str_r, int base_r = 10 )
+    {
+      TInt ret {};
+      strtonum( str_r, ret, base_r );
+      return ret;
+    }
+
     ///////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -181,6 +244,9 @@ namespace zypp
 
       /** \ref splitRx working horse */
       unsigned _splitRx(std::string_view line_r, const regex & rx_r, const WordConsumer& fnc_r );
+
+      /** \ref splitEscaped working horse */
+      unsigned _splitEscaped( std::string_view line_r, std::string_view sepchars_r, bool withEmpty_r, const WordConsumer & fnc_r ) ZYPP_API;
     }  // namespace detail
     ///////////////////////////////////////////////////////////////////
 
@@ -283,6 +349,29 @@ namespace zypp
     inline unsigned split( std::string_view line_r, Callable && fnc_r = Callable() )
     { return detail::_split( line_r, std::string_view(), Trim::notrim, detail::wordConsumer( std::forward<Callable>(fnc_r) ) ); }
 
+    /** Split \a line_r into words separated by any of \a sepchars_r, handling quotes and escapes.
+     *
+     * Same syntax and results as \ref str::splitEscaped, but the words are reported
+     * to \a fnc_r instead of being stored. Words not using any quoting or escaping
+     * are reported as view into \a line_r. Otherwise they are unescaped into a buffer
+     * reused for all words of the line. So the reported view is valid only during
+     * the callback.
+     *
+     * Accepted callbacks: [bool|void]( [std::string_view[, unsigned[, bool]]] )
+     * (or no callback at all). Returning \c false stops the split at once (no
+     * further words are reported).
+     *
+     * \returns the number of words reported.
+     */
+    template <typename Callable = detail::WordConsumer>
+    unsigned splitEscaped( std::string_view line_r, std::string_view sepchars_r, bool withEmpty_r, Callable && fnc_r = Callable() )
+    { return detail::_splitEscaped( line_r, sepchars_r, withEmpty_r, detail::wordConsumer( std::forward<Callable>(fnc_r) ) ); }
+
+    /** \overload Split at whitespace omitting empty words (like \ref str::splitEscaped) */
+    template <typename Callable = detail::WordConsumer>
+    unsigned splitEscaped( std::string_view line_r, Callable && fnc_r = Callable() )
+    { return detail::_splitEscaped( line_r, blank, false, detail::wordConsumer( std::forward<Callable>(fnc_r) ) ); }
+
     inline std::string_view asStringView( const char * t )
     { return t == nullptr ? std::string_view() : t; }
 
@@ -200,7 +200,7 @@ namespace zypp {
                   } else {
                     // Invalidate buffer and seek.
                     setg( &(_buffer[0]), &(_buffer[0]), &(_buffer[0]) );
-                    ret = this->seekTo( off_r, way_r, openMode );
+                    ret = this->seekTo( newFOff, way_r, openMode );
                   }
                 }
               }
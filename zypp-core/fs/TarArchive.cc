@@ -0,0 +1,315 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+/** \file zypp-core/fs/TarArchive.cc
+ *
+*/
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include <zypp-core/base/Logger.h>
+#include <zypp-core/base/String.h>
+#include <zypp-core/base/Exception.h>
+#include <zypp-core/base/GzStream>
+#include <zypp-core/fs/PathInfo.h>
+#include <zypp-core/fs/TarArchive.h>
+
+using std::endl;
+
+namespace zypp {
+  namespace filesystem {
+
+    namespace
+    {
+      constexpr off_t blockSize = 512;
+
+      /** Limit for the data of GNU long name and pax extended headers (read into memory). */
+      constexpr off_t maxHeaderDataSize = 1024 * 1024;
+
+      inline off_t blockAligned( off_t size_r )
+      { return ( size_r + blockSize - 1 ) / blockSize * blockSize; }
+
+      /** Numeric header field: octal (NUL or space terminated) or GNU base-256. */
+      off_t numField( const char * field_r, size_t len_r )
+      {
+        if ( len_r && ( field_r[0] & 0x80 ) )
+        {
+          off_t ret = field_r[0] & 0x3f;
+          for ( size_t i = 1; i < len_r; ++i )
+            ret = ( ret << 8 ) | static_cast<unsigned char>( field_r[i] );
+          return ret;
+        }
+        off_t ret = 0;
+        for ( size_t i = 0; i < len_r; ++i )
+        {
+          char ch = field_r[i];
+          if ( ch == ' ' && ret == 0 )
+            continue;	// leading blanks
+          if ( ch < '0' || ch > '7' )
+            break;
+          ret = ( ret << 3 ) + ( ch - '0' );
+        }
+        return ret;
+      }
+
+      /** String header field (NUL terminated unless full). */
+      inline std::string strField( const char * field_r, size_t len_r )
+      { return std::string( field_r, ::strnlen( field_r, len_r ) ); }
+
+      /** Whether the header checksum is valid (the field counts as blanks). */
+      bool validChecksum( const char * block_r )
+      {
+        unsigned long sum = 0;
+        for ( off_t i = 0; i < blockSize; ++i )
+          sum += ( i >= 148 && i < 156 ) ? ' ' : static_cast<unsigned char>( block_r[i] );
+        return sum == static_cast<unsigned long>( numField( block_r+148, 8 ) );
+      }
+
+      /** Value of \a key_r in pax extended header records (<tt>"LEN KEY=VALUE\n"</tt>). */
+      std::string paxValue( const std::string & data_r, const std::string & key_r )
+      {
+        std::string::size_type pos = 0;
+        while ( pos < data_r.size() )
+        {
+          std::string::size_type sp = data_r.find( ' ', pos );
+          if ( sp == std::string::npos )
+            break;
+          std::string::size_type len = str::strtonum<std::string::size_type>( data_r.substr( pos, sp-pos ) );
+          if ( len == 0 || pos + len > data_r.size() )
+            break;
+          std::string rec( data_r, sp+1, pos+len-sp-2 ); // w/o trailing NL
+          std::string::size_type eq = rec.find( '=' );
+          if ( eq != std::string::npos && rec.compare( 0, eq, key_r ) == 0 )
+            return rec.substr( eq+1 );
+          pos += len;
+        }
+        return std::string();
+      }
+
+      /** Read the data of a GNU long name or pax extended header. */
+      inline std::string readData( std::istream & str_r, off_t size_r )
+      {
+        if ( size_r > maxHeaderDataSize )
+          ZYPP_THROW( Exception( "Oversized extended header in tar archive ("+str::numstring(size_r)+" bytes)" ) );
+        std::string ret( size_r, '\0' );
+        if ( size_r && ! str_r.read( &ret[0], size_r ) )
+          ZYPP_THROW( Exception( "Unexpected end of tar archive" ) );
+        str_r.seekg( blockAligned( size_r ) - size_r, std::ios_base::cur );
+        return ret;
+      }
+
+      ///////////////////////////////////////////////////////////////////
+      /// \brief The member index of an archive.
+      ///////////////////////////////////////////////////////////////////
+      struct Index
+      {
+        std::vector<TarArchive::Member> _members;
+        std::unordered_map<std::string, size_t> _files;	// regular files only
+
+        explicit Index( const Pathname & archive_r )
+        {
+          ifgzstream str( archive_r.c_str() );
+          if ( ! str.is_open() )
+            ZYPP_THROW( Exception( "Can't open tar archive " + archive_r.asString() ) );
+
+          // Member sizes are bounded by the file size unless the archive is compressed;
+          // then a truncated member is detected when extracting it.
+          off_t fileSize = -1;
+          {
+            PathInfo pi( archive_r );
+            unsigned char magic[2] = { 0, 0 };
+            std::ifstream raw( archive_r.c_str(), std::ios_base::binary );
+            if ( ! ( raw.read( reinterpret_cast<char *>(magic), 2 ) && magic[0] == 0x1f && magic[1] == 0x8b ) )
+              fileSize = pi.size();
+          }
+
+          char block[blockSize];
+          std::string longName;	// from a preceding GNU 'L' or pax 'x' header
+          off_t pos = 0;
+          while ( str.read( block, blockSize ) )
+          {
+            pos += blockSize;
+            if ( block[0] == '\0' )
+              break;	// end of archive marker
+            if ( ! validChecksum( block ) )
+              ZYPP_THROW( Exception( "Bad header checksum in tar archive " + archive_r.asString() ) );
+
+            char type = block[156];
+            off_t size = numField( block+124, 12 );
+            if ( size < 0 || ( fileSize >= 0 && size > fileSize - pos ) )
+              ZYPP_THROW( Exception( "Bad member size in tar archive " + archive_r.asString() ) );
+
+            if ( type == 'L' )		// GNU long name for the next member
+            {
+              longName = readData( str, size );
+              longName.erase( ::strnlen( longName.c_str(), longName.size() ) );
+              pos += blockAligned( size );
+              continue;
+            }
+            if ( type == 'x' )		// pax extended header for the next member
+            {
+              longName = paxValue( readData( str, size ), "path" );
+              pos += blockAligned( size );
+              continue;
+            }
+            if ( type == 'g' || type == 'K' )	// global pax header, GNU long link
+            {
+              str.seekg( blockAligned( size ), std::ios_base::cur );
+              pos += blockAligned( size );
+              continue;
+            }
+
+            TarArchive::Member member;
+            if ( ! longName.empty() )
+              member.name.swap( longName );
+            else
+            {
+              member.name = strField( block, 100 );
+              if ( ::strncmp( block+257, "ustar", 5 ) == 0 && block[345] )
+                member.name = strField( block+345, 155 ) + "/" + member.name;
+            }
+            member.type = type;
+            member.offset = pos;
+            member.size = ( type == '5' || type == '1' || type == '2' ) ? 0 : size;
+
+            if ( member.isFile() )
+              _files[member.name] = _members.size();
+            _members.push_back( std::move(member) );
+
+            if ( size )
+            {
+              str.seekg( blockAligned( size ), std::ios_base::cur );
+              pos += blockAligned( size );
+            }
+          }
+          if ( str.gcount() && str.gcount() != blockSize )
+            ZYPP_THROW( Exception( "Unexpected end of tar archive " + archive_r.asString() ) );
+          DBG << "Indexed " << _members.size() << " members of " << archive_r << endl;
+        }
+      };
+
+      ///////////////////////////////////////////////////////////////////
+      /// \brief Indices cached per archive, revalidated by mtime and size.
+      ///////////////////////////////////////////////////////////////////
+      struct IndexCache
+      {
+        struct Entry
+        {
+          time_t _mtime;
+          off_t  _size;
+          shared_ptr<const Index> _index;
+        };
+
+        static IndexCache & instance()
+        {
+          static IndexCache _instance;
+          return _instance;
+        }
+
+        shared_ptr<const Index> get( const Pathname & archive_r )
+        {
+          PathInfo pi( archive_r );
+          if ( ! pi.isFile() )
+            ZYPP_THROW( Exception( "No tar archive " + archive_r.asString() ) );
+
+          std::lock_guard<std::mutex> guard( _mutex );
+          Entry & entry { _entries[archive_r] };
+          if ( ! entry._index || entry._mtime != pi.mtime() || entry._size != pi.size() )
+          {
+            entry._index.reset( new Index( archive_r ) );	// may throw
+            entry._mtime = pi.mtime();
+            entry._size = pi.size();
+          }
+          return entry._index;
+        }
+
+        void clear()
+        {
+          std::lock_guard<std::mutex> guard( _mutex );
+          _entries.clear();
+        }
+
+      private:
+        std::mutex _mutex;
+        std::map<Pathname, Entry> _entries;
+      };
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////
+    /// \class TarArchive::Impl
+    /// \brief TarArchive implementation.
+    ///////////////////////////////////////////////////////////////////
+    class TarArchive::Impl
+    {
+    public:
+      Impl( Pathname archive_r )
+      : _path( std::move(archive_r) )
+      , _index( IndexCache::instance().get( _path ) )
+      {}
+
+      Pathname _path;
+      shared_ptr<const Index> _index;
+    };
+
+    TarArchive::TarArchive( Pathname archive_r )
+    : _pimpl( new Impl( std::move(archive_r) ) )
+    {}
+
+    TarArchive::~TarArchive()
+    {}
+
+    const Pathname & TarArchive::path() const
+    { return _pimpl->_path; }
+
+    const std::vector<TarArchive::Member> & TarArchive::members() const
+    { return _pimpl->_index->_members; }
+
+    bool TarArchive::hasMember( const std::string & name_r ) const
+    { return _pimpl->_index->_files.count( name_r ); }
+
+    std::string TarArchive::extract( const std::string & name_r ) const
+    {
+      const auto & files { _pimpl->_index->_files };
+      auto it { files.find( name_r ) };
+      if ( it == files.end() )
+        ZYPP_THROW( Exception( "No file " + name_r + " in tar archive " + _pimpl->_path.asString() ) );
+
+      const Member & member { _pimpl->_index->_members[it->second] };
+      ifgzstream str( _pimpl->_path.c_str() );
+      if ( ! str.is_open() )
+        ZYPP_THROW( Exception( "Can't open tar archive " + _pimpl->_path.asString() ) );
+      if ( member.offset )
+        str.seekg( member.offset, std::ios_base::beg );
+
+      // Read in chunks rather than allocating the size stated in the header
+      // up front; a compressed archive may be truncated.
+      std::string ret;
+      char buf[64 * 1024];
+      for ( off_t left = member.size; left; )
+      {
+        std::streamsize chunk = std::min<off_t>( left, sizeof(buf) );
+        if ( ! str.read( buf, chunk ) )
+          ZYPP_THROW( Exception( "Can't read " + name_r + " from tar archive " + _pimpl->_path.asString() ) );
+        ret.append( buf, chunk );
+        left -= chunk;
+      }
+      return ret;
+    }
+
+    void TarArchive::clearCache()
+    { IndexCache::instance().clear(); }
+
+    std::ostream & operator<<( std::ostream & str, const TarArchive & obj )
+    { return str << "TarArchive(" << obj.path() << ", " << obj.members().size() << " members)"; }
+
+  } // namespace filesystem
+} // namespace zypp
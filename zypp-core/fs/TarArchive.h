@@ -0,0 +1,98 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+/** \file zypp-core/fs/TarArchive.h
+ *
+*/
+#ifndef ZYPP_CORE_FS_TARARCHIVE_H
+#define ZYPP_CORE_FS_TARARCHIVE_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <zypp-core/Pathname.h>
+#include <zypp-core/base/PtrTypes.h>
+
+namespace zypp {
+  namespace filesystem {
+
+    ///////////////////////////////////////////////////////////////////
+    /// \class TarArchive
+    /// \brief Read access to a (gzip compressed) tar archive without calling \c tar.
+    ///
+    /// The archive is read through \ref ifgzstream, so plain and gzip
+    /// compressed archives are supported. Ustar, GNU long name and pax
+    /// path headers are understood.
+    ///
+    /// The member index is built once and cached per archive. The cache
+    /// entry is revalidated by the archives mtime and size, so a rewritten
+    /// archive is indexed again.
+    ///
+    /// \code
+    ///   TarArchive tgz( "license.tar.gz" );
+    ///   for ( const auto & member : tgz.members() )
+    ///     cout << member.name << endl;
+    ///   std::string text( tgz.extract( "license.txt" ) );
+    /// \endcode
+    ///////////////////////////////////////////////////////////////////
+    class ZYPP_API TarArchive
+    {
+    public:
+      /** A member of the archive. */
+      struct Member
+      {
+        std::string name;	///< as stored in the archive (like <tt>tar -t</tt>)
+        char        type;	///< ustar typeflag (\c '0' regular file, \c '5' directory,...)
+        off_t       offset;	///< of the data within the uncompressed archive
+        off_t       size;	///< of the data
+
+        bool isFile() const
+        { return type == '0' || type == '\0' || type == '7'; }
+      };
+
+    public:
+      /** Ctor indexing \a archive_r (or using the cached index).
+       * \throws Exception if the archive can not be read or is malformed.
+       */
+      explicit TarArchive( Pathname archive_r );
+
+      /** Dtor */
+      ~TarArchive();
+
+    public:
+      /** The archive. */
+      const Pathname & path() const;
+
+      /** All members in archive order. */
+      const std::vector<Member> & members() const;
+
+      /** Whether the archive contains a regular file \a name_r. */
+      bool hasMember( const std::string & name_r ) const;
+
+      /** Return the content of the regular file \a name_r.
+       * \throws Exception if \a name_r is not a file in the archive or can not be read.
+       */
+      std::string extract( const std::string & name_r ) const;
+
+    public:
+      /** Drop all cached archive indices. */
+      static void clearCache();
+
+    public:
+      class Impl;
+    private:
+      RW_pointer<Impl> _pimpl;
+    };
+
+    /** \relates TarArchive Stream output */
+    std::ostream & operator<<( std::ostream & str, const TarArchive & obj ) ZYPP_API;
+
+  } // namespace filesystem
+} // namespace zypp
+#endif // ZYPP_CORE_FS_TARARCHIVE_H
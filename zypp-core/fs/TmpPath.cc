@@ -13,13 +13,19 @@
 #include <cstdlib>
 #include <cstring>
 #include <cerrno>
+#include <fcntl.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #include <iostream>
+#include <atomic>
+#include <mutex>
 #include <utility>
 
 #include <zypp-core/base/ReferenceCounted.h>
 #include <zypp-core/base/NonCopyable.h>
 #include <zypp-core/base/Logger.h>
+#include <zypp-core/base/String.h>
 #include <zypp-core/fs/PathInfo.h>
 #include <zypp-core/fs/TmpPath.h>
 
@@ -51,6 +57,10 @@ namespace zypp {
         Impl(Pathname &&path_r, Flags flags_r = CtorDefault)
           : _path(std::move(path_r)), _flags(flags_r) {}
 
+        /** An entry in a \ref TmpArena, keeping the arena alive. */
+        Impl(Pathname &&path_r, shared_ptr<const void> owner_r)
+          : _path(std::move(path_r)), _flags(CtorDefault), _owner(std::move(owner_r)) {}
+
         Impl(const Impl &) = delete;
         Impl(Impl &&) = delete;
         Impl &operator=(const Impl &) = delete;
@@ -95,6 +105,7 @@ namespace zypp {
       private:
         Pathname _path;
         Flags    _flags;
+        shared_ptr<const void> _owner;	///< released after _path is removed
     };
     ///////////////////////////////////////////////////////////////////
 
@@ -212,6 +223,9 @@ namespace zypp {
         ERR << "Cant create '" << buf << "' " << ::strerror( errno ) << endl;
     }
 
+    TmpFile::TmpFile( RW_pointer<Impl> impl_r )
+    { _impl = std::move(impl_r); }
+
     ///////////////////////////////////////////////////////////////////
     //
     //	METHOD NAME : TmpFile::makeSibling
@@ -328,5 +342,351 @@ namespace zypp {
       return p;
     }
 
+    ///////////////////////////////////////////////////////////////////
+    namespace
+    {
+      /** Disk space used by the entries below \a dirfd_r (takes ownership of the fd). */
+      ByteCount::SizeType diskUsageBelow( int dirfd_r )
+      {
+        DIR * dir = ::fdopendir( dirfd_r );
+        if ( ! dir )
+        {
+          ::close( dirfd_r );
+          return 0;
+        }
+
+        ByteCount::SizeType ret = 0;
+        while ( struct dirent * entry = ::readdir( dir ) )
+        {
+          if ( entry->d_name[0] == '.' && ( entry->d_name[1] == '\0' || ( entry->d_name[1] == '.' && entry->d_name[2] == '\0' ) ) )
+            continue;
+
+          struct stat st;
+          if ( ::fstatat( ::dirfd( dir ), entry->d_name, &st, AT_SYMLINK_NOFOLLOW ) != 0 )
+            continue;
+          ret += st.st_blocks * 512;
+
+          if ( S_ISDIR( st.st_mode ) )
+          {
+            int subfd = ::openat( ::dirfd( dir ), entry->d_name, O_RDONLY|O_DIRECTORY|O_NOFOLLOW|O_CLOEXEC );
+            if ( subfd != -1 )
+              ret += diskUsageBelow( subfd );
+          }
+        }
+        ::closedir( dir );
+        return ret;
+      }
+    } // namespace
+    ///////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////
+    //
+    //	CLASS NAME : TmpArena::Impl
+    //
+    class TmpArena::Impl : public base::ReferenceCounted, private base::NonCopyable
+    {
+      public:
+        Impl( const Pathname & inParentDir_r, const std::string & prefix_r )
+          : _dir( inParentDir_r, prefix_r )
+        {}
+
+        Impl(const Impl &) = delete;
+        Impl(Impl &&) = delete;
+        Impl &operator=(const Impl &) = delete;
+        Impl &operator=(Impl &&) = delete;
+
+        ~Impl() override
+        {
+          if ( _dir )
+          {
+            if ( _trackPeakUsage )
+              notePeakUsage( diskUsage() );
+            MIL << "TmpArena " << _dir << " done: " << stats() << endl;
+          }
+          // _dir removes all the remaining entries at once
+        }
+
+        Pathname path() const
+        { return _dir.path(); }
+
+        Pathname reserveName( const std::string & prefix_r )
+        { return _dir.path() / ( prefix_r + str::numstring( ++_serial ) ); }
+
+        ByteCount diskUsage() const
+        {
+          if ( ! _dir )
+            return ByteCount();
+          int dirfd = ::open( _dir.path().c_str(), O_RDONLY|O_DIRECTORY|O_CLOEXEC );
+          return dirfd == -1 ? ByteCount() : ByteCount( diskUsageBelow( dirfd ) );
+        }
+
+        void notePeakUsage( const ByteCount & usage_r ) const
+        {
+          std::lock_guard<std::mutex> guard( _statsMutex );
+          if ( usage_r > _stats._peakUsage )
+            _stats._peakUsage = usage_r;
+        }
+
+        void count( unsigned Stats::* counter_r )
+        {
+          std::lock_guard<std::mutex> guard( _statsMutex );
+          ++( _stats.*counter_r );
+        }
+
+        Stats stats() const
+        {
+          std::lock_guard<std::mutex> guard( _statsMutex );
+          return _stats;
+        }
+
+        bool trackPeakUsage() const
+        { return _trackPeakUsage; }
+
+        void trackPeakUsage( bool yesno_r )
+        { _trackPeakUsage = yesno_r; }
+
+      private:
+        TmpDir                _dir;
+        std::atomic<bool>     _trackPeakUsage { false };
+        std::atomic<unsigned> _serial { 0 };
+        mutable std::mutex    _statsMutex;
+        mutable Stats         _stats;
+    };
+    ///////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////
+    //
+    //	CLASS NAME : TmpArena
+    //
+    ///////////////////////////////////////////////////////////////////
+
+    TmpArena::TmpArena( const Pathname & inParentDir_r, const std::string & prefix_r )
+    : _impl( new Impl( inParentDir_r, prefix_r ) )
+    {}
+
+    TmpArena::~TmpArena()
+    {}
+
+    TmpArena::operator bool() const
+    { return ! _impl->path().empty(); }
+
+    Pathname TmpArena::path() const
+    { return _impl->path(); }
+
+    Pathname TmpArena::reserveName( const std::string & prefix_r )
+    {
+      if ( ! *this )
+        return Pathname();
+      return _impl->reserveName( prefix_r );
+    }
+
+    Pathname TmpArena::newFile( const std::string & prefix_r )
+    {
+      if ( ! *this )
+        return Pathname();
+
+      Pathname ret { _impl->reserveName( prefix_r ) };
+      int fd = ::open( ret.c_str(), O_CREAT|O_EXCL|O_WRONLY|O_CLOEXEC, 0600 );
+      if ( fd == -1 )
+      {
+        ERR << "Cant create '" << ret << "' " << ::strerror( errno ) << endl;
+        return Pathname();
+      }
+      ::close( fd );
+      _impl->count( &Stats::_files );
+      return ret;
+    }
+
+    TmpFile TmpArena::newTmpFile( const std::string & prefix_r )
+    {
+      Pathname file { newFile( prefix_r ) };
+      if ( file.empty() )
+        return TmpFile( RW_pointer<TmpFile::Impl>() );
+      return TmpFile( RW_pointer<TmpFile::Impl>( new TmpFile::Impl( std::move(file), _impl.getPtr() ) ) );
+    }
+
+    Pathname TmpArena::newDir( const std::string & prefix_r )
+    {
+      if ( ! *this )
+        return Pathname();
+
+      Pathname ret { _impl->reserveName( prefix_r ) };
+      if ( ::mkdir( ret.c_str(), 0700 ) != 0 )
+      {
+        ERR << "Cant create '" << ret << "' " << ::strerror( errno ) << endl;
+        return Pathname();
+      }
+      _impl->count( &Stats::_dirs );
+      return ret;
+    }
+
+    TmpArena::AnonymousFile TmpArena::newAnonymousFile()
+    {
+      if ( ! *this )
+        return AnonymousFile();
+
+#ifdef O_TMPFILE
+      int fd = ::open( path().c_str(), O_TMPFILE|O_RDWR|O_CLOEXEC, 0600 );
+      if ( fd != -1 )
+      {
+        _impl->count( &Stats::_anonymous );
+        return AnonymousFile( _impl, fd, Pathname() );
+      }
+      if ( errno != EOPNOTSUPP && errno != EISDIR && errno != EINVAL )
+      {
+        ERR << "Cant create anonymous file in '" << path() << "' " << ::strerror( errno ) << endl;
+        return AnonymousFile();
+      }
+      // filesystem does not support O_TMPFILE: use a named one
+#endif
+      Pathname name { _impl->reserveName( "anon." ) };
+      int namedFd = ::open( name.c_str(), O_CREAT|O_EXCL|O_RDWR|O_CLOEXEC, 0600 );
+      if ( namedFd == -1 )
+      {
+        ERR << "Cant create '" << name << "' " << ::strerror( errno ) << endl;
+        return AnonymousFile();
+      }
+      _impl->count( &Stats::_anonymous );
+      return AnonymousFile( _impl, namedFd, std::move(name) );
+    }
+
+    void TmpArena::clear()
+    {
+      if ( ! *this )
+        return;
+
+      if ( _impl->trackPeakUsage() )
+        _impl->notePeakUsage( _impl->diskUsage() );
+      int res = clean_dir( path() );
+      if ( res )
+        INT << "TmpArena cleanup error (" << res << ") " << path() << endl;
+      _impl->count( &Stats::_cleanups );
+    }
+
+    ByteCount TmpArena::diskUsage() const
+    {
+      ByteCount ret { _impl->diskUsage() };
+      _impl->notePeakUsage( ret );
+      return ret;
+    }
+
+    TmpArena::Stats TmpArena::stats() const
+    { return _impl->stats(); }
+
+    bool TmpArena::trackPeakUsage() const
+    { return _impl->trackPeakUsage(); }
+
+    void TmpArena::trackPeakUsage( bool yesno_r )
+    { _impl->trackPeakUsage( yesno_r ); }
+
+    const std::string & TmpArena::defaultPrefix()
+    {
+      static std::string p( "TmpArena." );
+      return p;
+    }
+
+    std::ostream & operator<<( std::ostream & str, const TmpArena & obj )
+    { return str << obj.path(); }
+
+    std::ostream & operator<<( std::ostream & str, const TmpArena::Stats & obj )
+    {
+      return str << "{files " << obj._files
+                 << ", dirs " << obj._dirs
+                 << ", anonymous " << obj._anonymous
+                 << " (" << obj._committed << " committed)"
+                 << ", cleanups " << obj._cleanups
+                 << ", peak usage " << obj._peakUsage << "}";
+    }
+
+    ///////////////////////////////////////////////////////////////////
+    //
+    //	CLASS NAME : TmpArena::AnonymousFile
+    //
+    ///////////////////////////////////////////////////////////////////
+
+    TmpArena::AnonymousFile::AnonymousFile()
+    {}
+
+    TmpArena::AnonymousFile::AnonymousFile( RW_pointer<TmpArena::Impl> arena_r, int fd_r, Pathname name_r )
+    : _arena( std::move(arena_r) )
+    , _fd( fd_r )
+    , _name( std::move(name_r) )
+    {}
+
+    TmpArena::AnonymousFile::AnonymousFile( AnonymousFile && rhs ) noexcept
+    : _arena( std::move(rhs._arena) )
+    , _fd( std::exchange( rhs._fd, -1 ) )
+    , _name( std::move(rhs._name) )
+    {}
+
+    TmpArena::AnonymousFile & TmpArena::AnonymousFile::operator=( AnonymousFile && rhs ) noexcept
+    {
+      if ( this != &rhs )
+      {
+        reset();
+        _arena = std::move(rhs._arena);
+        _fd    = std::exchange( rhs._fd, -1 );
+        _name  = std::move(rhs._name);
+      }
+      return *this;
+    }
+
+    TmpArena::AnonymousFile::~AnonymousFile()
+    { reset(); }
+
+    void TmpArena::AnonymousFile::reset()
+    {
+      if ( _fd != -1 )
+      {
+        ::close( _fd );
+        _fd = -1;
+      }
+      if ( ! _name.empty() )
+      {
+        ::unlink( _name.c_str() );
+        _name = Pathname();
+      }
+      _arena.reset();
+    }
+
+    int TmpArena::AnonymousFile::commit( const Pathname & target_r )
+    {
+      if ( _fd == -1 )
+        return EBADF;
+
+      int res = 0;
+      if ( _name.empty() )
+      {
+        // give the nameless file a name in the arena, then move it into place
+        Pathname name { _arena->reserveName( "anon." ) };
+        std::string fdPath { "/proc/self/fd/" + str::numstring( _fd ) };
+        if ( ::linkat( AT_FDCWD, fdPath.c_str(), AT_FDCWD, name.c_str(), AT_SYMLINK_FOLLOW ) != 0 )
+        {
+          res = errno;
+          ERR << "Cant link anonymous file to '" << name << "' " << ::strerror( res ) << endl;
+        }
+        else
+          _name = std::move(name);
+      }
+
+      if ( ! res )
+      {
+        if ( ::rename( _name.c_str(), target_r.c_str() ) != 0 )
+        {
+          res = errno;
+          ERR << "Cant move '" << _name << "' to '" << target_r << "' " << ::strerror( res ) << endl;
+        }
+        else
+        {
+          DBG << "Committed anonymous file to " << target_r << endl;
+          _name = Pathname();
+          _arena->count( &Stats::_committed );
+        }
+      }
+
+      reset();
+      return res;
+    }
+
   } // namespace filesystem
 } // namespace zypp
@@ -17,6 +17,7 @@
 #include <zypp-core/Pathname.h>
 #include <zypp-core/base/PtrTypes.h>
 #include <zypp-core/ManagedFile.h>
+#include <zypp-core/ByteCount.h>
 
 namespace zypp {
   namespace filesystem {
@@ -160,6 +161,10 @@ namespace zypp {
         static const std::string &
         defaultPrefix();
 
+      private:
+        friend class TmpArena;
+        /** TmpArena ctor: \ref TmpArena::newTmpFile */
+        explicit TmpFile( RW_pointer<Impl> impl_r );
     };
     ///////////////////////////////////////////////////////////////////
 
@@ -210,6 +215,238 @@ namespace zypp {
     };
     ///////////////////////////////////////////////////////////////////
 
+    ///////////////////////////////////////////////////////////////////
+    //
+    //	CLASS NAME : TmpArena
+    /**
+     * @short One temporary directory hosting all the temporaries of an
+     * operation, removed in one go when no longer needed.
+     *
+     * Creating a \ref TmpFile or \ref TmpDir per temporary costs a
+     * \c mkstemp and a later \c unlink each. Operations creating lots of
+     * temporaries better create a TmpArena and take the temporaries from
+     * there. The arena directory is created like a \ref TmpDir (mode 0700),
+     * so names inside can be handed out by a simple counter without any
+     * race. Entries are not deleted one by one, but together when the last
+     * reference to the arena drops (or on \ref clear).
+     *
+     * Like \ref TmpPath, copies share the same arena. It's safe to use the
+     * same arena from multiple threads.
+     *
+     * \code
+     *   TmpArena arena( TmpPath::defaultLocation(), "refresh." );
+     *   Pathname a = arena.newFile( "key-" );  // /var/tmp/refresh.XXXXXX/key-1
+     *   Pathname b = arena.newFile( "key-" );  // /var/tmp/refresh.XXXXXX/key-2
+     *   MIL << arena.stats() << endl;
+     * \endcode
+     **/
+    class ZYPP_API TmpArena
+    {
+      public:
+        /** Statistics about an arena's use. */
+        struct ZYPP_API Stats
+        {
+          unsigned _files = 0;		///< named files created
+          unsigned _dirs = 0;		///< directories created
+          unsigned _anonymous = 0;	///< \ref AnonymousFile opened
+          unsigned _committed = 0;	///< \ref AnonymousFile linked into place
+          unsigned _cleanups = 0;	///< batched cleanups (\ref clear)
+          ByteCount _peakUsage;		///< max. \ref diskUsage seen when asked (or before a cleanup if \ref trackPeakUsage)
+        };
+
+        class AnonymousFile;
+
+      public:
+        /**
+         * Default Ctor. Creates the arena directory in \a inParentDir_r,
+         * named \a prefix_r followed by a unique suffix.
+         **/
+        explicit
+        TmpArena( const Pathname & inParentDir_r = TmpPath::defaultLocation(),
+                  const std::string & prefix_r = defaultPrefix() );
+
+        /**
+         * Dtor.
+         **/
+        ~TmpArena();
+
+        /**
+         * Whether the arena directory was created.
+         **/
+        explicit operator bool() const;
+
+        /**
+         * @return The arena directory or an empty path in case of any error.
+         **/
+        Pathname
+        path() const;
+
+      public:
+        /**
+         * A new unique name \c path()/<prefix_r><N>, not created on disk.
+         * Nothing else creates entries in the arena, so the name is still
+         * free when the caller creates it.
+         **/
+        Pathname
+        reserveName( const std::string & prefix_r = std::string() );
+
+        /**
+         * Create a new empty file (mode 0600).
+         * @return The file or an empty path in case of any error.
+         **/
+        Pathname
+        newFile( const std::string & prefix_r = TmpFile::defaultPrefix() );
+
+        /**
+         * Create a new empty file (mode 0600) owned by a \ref TmpFile.
+         * The file is removed when the last TmpFile reference drops, and
+         * the TmpFile keeps the arena alive. Use it where an API wants a
+         * \ref TmpFile, but the entries should be gathered in the arena.
+         * @return The file or an empty TmpFile in case of any error.
+         **/
+        TmpFile
+        newTmpFile( const std::string & prefix_r = TmpFile::defaultPrefix() );
+
+        /**
+         * Create a new empty directory (mode 0700).
+         * @return The directory or an empty path in case of any error.
+         **/
+        Pathname
+        newDir( const std::string & prefix_r = TmpDir::defaultPrefix() );
+
+        /**
+         * Open a new nameless file for writing, see \ref AnonymousFile.
+         **/
+        AnonymousFile
+        newAnonymousFile();
+
+        /**
+         * Remove all entries at once. The arena stays usable.
+         * Files still opened as \ref AnonymousFile are not affected.
+         **/
+        void
+        clear();
+
+      public:
+        /**
+         * Disk space currently used by the entries in the arena.
+         * Computed by walking the arena, nameless \ref AnonymousFile
+         * are not included.
+         **/
+        ByteCount
+        diskUsage() const;
+
+        /**
+         * Statistics about the arena's use.
+         **/
+        Stats
+        stats() const;
+
+        /**
+         * Whether \ref clear and the dtor walk the arena to update the
+         * peak usage in \ref stats. Off by default, as the walk costs a
+         * \c stat per entry.
+         **/
+        bool
+        trackPeakUsage() const;
+
+        /**
+         * Turn \ref trackPeakUsage on/off.
+         **/
+        void
+        trackPeakUsage( bool yesno_r );
+
+        /**
+         * @return The default prefix for arena directories (TmpArena.)
+         **/
+        static const std::string &
+        defaultPrefix();
+
+      private:
+        class Impl;
+        RW_pointer<Impl> _impl;
+    };
+    ///////////////////////////////////////////////////////////////////
+
+    ///////////////////////////////////////////////////////////////////
+    //
+    //	CLASS NAME : TmpArena::AnonymousFile
+    /**
+     * @short A file opened for writing, linked into place only on success.
+     *
+     * If the filesystem supports it, the file is created with \c O_TMPFILE
+     * and has no name until \ref commit links it to the target. If the data
+     * turn out to be bad, simply dropping the AnonymousFile removes it.
+     * Otherwise a named file in the arena is used and renamed on commit.
+     *
+     * The target must be on the same filesystem as the arena.
+     **/
+    class ZYPP_API TmpArena::AnonymousFile
+    {
+      public:
+        /**
+         * Default Ctor. No file.
+         **/
+        AnonymousFile();
+
+        AnonymousFile( const AnonymousFile & ) = delete;
+        AnonymousFile & operator=( const AnonymousFile & ) = delete;
+
+        AnonymousFile( AnonymousFile && rhs ) noexcept;
+        AnonymousFile & operator=( AnonymousFile && rhs ) noexcept;
+
+        /**
+         * Dtor. Closes and removes the file unless it was committed.
+         **/
+        ~AnonymousFile();
+
+        /**
+         * Whether a file is open.
+         **/
+        explicit operator bool() const
+        { return _fd != -1; }
+
+        /**
+         * The file descriptor opened for reading and writing or \c -1.
+         **/
+        int
+        fd() const
+        { return _fd; }
+
+        /**
+         * Whether the file is actually nameless (\c O_TMPFILE).
+         **/
+        bool
+        nameless() const
+        { return _fd != -1 && _name.empty(); }
+
+        /**
+         * Close the file and atomically replace \a target_r by it.
+         * @return 0 on success, errno on failure (e.g. \c EXDEV if
+         * \a target_r is on a different filesystem than the arena).
+         * The file is gone afterwards, no matter whether the commit
+         * succeeded or failed.
+         **/
+        int
+        commit( const Pathname & target_r );
+
+      private:
+        friend class TmpArena;
+        AnonymousFile( RW_pointer<TmpArena::Impl> arena_r, int fd_r, Pathname name_r );
+        void reset();
+
+        RW_pointer<TmpArena::Impl> _arena;
+        int      _fd = -1;
+        Pathname _name;	///< empty if nameless
+    };
+    ///////////////////////////////////////////////////////////////////
+
+    /** \relates TmpArena Stream output */
+    std::ostream & operator<<( std::ostream & str, const TmpArena & obj ) ZYPP_API;
+
+    /** \relates TmpArena::Stats Stream output */
+    std::ostream & operator<<( std::ostream & str, const TmpArena::Stats & obj ) ZYPP_API;
+
   } // namespace filesystem
 
   /** Global access to the zypp.TMPDIR (created on demand, deleted when libzypp is unloaded) */
@@ -435,6 +435,17 @@ namespace zyppng {
     return false;
   }
 
+  unsigned CurlMultiPartHandler::rangeBatchSize() const
+  {
+    return _rangeAttempt[_rangeAttemptIdx];
+  }
+
+  void CurlMultiPartHandler::setMaxRangeBatchSize( unsigned maxRanges )
+  {
+    while ( _rangeAttemptIdx + 1 < _rangeAttemptSize && _rangeAttempt[_rangeAttemptIdx] > maxRanges )
+      _rangeAttemptIdx++;
+  }
+
   bool CurlMultiPartHandler::hasMoreWork() const
   {
     // check if we have ranges that have never been requested
@@ -148,6 +148,17 @@ namespace zyppng {
       std::optional<size_t> reportedFileSize() const;
       std::optional<off_t>  currentRange() const;
 
+      /*!
+       * The max nr of ranges currently requested at once.
+       */
+      unsigned rangeBatchSize() const;
+
+      /*!
+       * Start with a batch size of at most \a maxRanges, e.g. because it is already
+       * known that the server can not handle more. This saves the failing attempts.
+       */
+      void setMaxRangeBatchSize( unsigned maxRanges );
+
   private:
 
       void setCode ( Code c, std::string msg, bool force = false );
@@ -11,6 +11,7 @@
 #include <zypp-curl/ng/network/private/networkrequesterror_p.h>
 #include <zypp-curl/ng/network/networkrequestdispatcher.h>
 #include <utility>
+#include <zypp-curl/ProxyInfo>
 #include <zypp-curl/TransferSettings>
 #include <zypp-curl/private/curlhelper_p.h>
 #include <zypp-media/MediaException>
@@ -22,6 +23,7 @@ namespace zyppng {
     : BasePrivate(p)
     , _requestDispatcher ( std::move(requestDispatcher) )
     , _mirrorControl( std::move(mirrors) )
+    , _hostCaps( std::make_shared<HostCapabilityCache>() )
     , _spec( std::move(spec) )
     , _parent( &parent )
   {}
@@ -336,6 +338,7 @@ namespace zyppng {
   DownloaderPrivate::DownloaderPrivate(std::shared_ptr<MirrorControl> mc, Downloader &p)
     : BasePrivate(p)
     , _mirrors( std::move(mc) )
+    , _hostCaps( std::make_shared<HostCapabilityCache>() )
   {
     _requestDispatcher = std::make_shared<NetworkRequestDispatcher>( );
     if ( !_mirrors ) {
@@ -389,7 +392,12 @@ namespace zyppng {
   std::shared_ptr<Download> Downloader::downloadFile(const zyppng::DownloadSpec &spec )
   {
     Z_D();
+    // let a PAC based proxy setup evaluate while the download is set up
+    if ( spec.settings().proxy().empty() )
+      zypp::media::ProxyInfo::prefetch( spec.url() );
+
     std::shared_ptr<Download> dl ( new Download ( *this, d->_requestDispatcher, d->_mirrors, DownloadSpec(spec) ) );
+    dl->d_func()->_hostCaps = d->_hostCaps;
 
     d->_runningDownloads.push_back( dl );
     dl->connect( &Download::sigFinished, *d, &DownloaderPrivate::onDownloadFinished );
@@ -403,6 +411,11 @@ namespace zyppng {
     return d_func()->_requestDispatcher;
   }
 
+  void Downloader::setCapabilityCacheDir( const zypp::Pathname &cacheDir )
+  {
+    d_func()->_hostCaps->setCacheDir( cacheDir );
+  }
+
   SignalProxy<void (Downloader &parent, Download &download)> Downloader::sigStarted()
   {
     return d_func()->_sigStarted;
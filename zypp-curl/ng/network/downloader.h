@@ -9,6 +9,7 @@
 #include <zypp-curl/ng/network/AuthData>
 
 #include <zypp-core/ByteCount.h>
+#include <zypp-core/Pathname.h>
 
 namespace zypp::media {
   class TransferSettings;
@@ -58,6 +59,13 @@ namespace zyppng {
      */
     std::shared_ptr<NetworkRequestDispatcher> requestDispatcher () const;
 
+    /*!
+     * Directory to remember the capabilities of the servers in, e.g. whether they serve
+     * metalink files or support multiple ranges per request. This saves probing them again
+     * in the next session. By default the capabilities are kept in memory only.
+     */
+    void setCapabilityCacheDir ( const zypp::Pathname &cacheDir );
+
     /*!
      * Emitted when a \sa zyppng::Download created by this Downloader instance was started
      */
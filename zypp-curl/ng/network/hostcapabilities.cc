@@ -0,0 +1,181 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+----------------------------------------------------------------------*/
+
+#include "private/hostcapabilities_p.h"
+
+#include <zypp-core/base/Logger.h>
+#include <zypp-core/base/StringV.h>
+#include <zypp-core/fs/PathInfo.h>
+#include <zypp-core/fs/TmpPath.h>
+
+#include <fstream>
+
+namespace zyppng {
+
+  namespace {
+
+    /** One cache file per host, the name must be usable as file name. */
+    std::string hostKey( const Url &url_r )
+    {
+      std::string ret { url_r.getScheme() + "_" + url_r.getHost() };
+      if ( ! url_r.getPort().empty() )
+        ret += "_" + url_r.getPort();
+      for ( auto &ch : ret ) {
+        if ( ! ( ::isalnum( ch ) || ch == '.' || ch == '-' || ch == '_' ) )
+          ch = '_';
+      }
+      return ret;
+    }
+
+    /** The directory of the file \a url_r points to, always ending with a '/'. */
+    std::string dirKey( const Url &url_r )
+    {
+      std::string path { url_r.getPathName( zypp::url::E_ENCODED ) };
+      path.erase( path.rfind( '/' ) + 1 );  // npos + 1 == 0
+      if ( path.empty() )
+        path = "/";
+      return path;
+    }
+
+    const char *asString( const zypp::TriBool &val_r )
+    { return zypp::indeterminate( val_r ) ? "?" : ( val_r ? "1" : "0" ); }
+
+    zypp::TriBool triBoolFrom( std::string_view val_r )
+    { return val_r == "1" ? zypp::TriBool( true ) : ( val_r == "0" ? zypp::TriBool( false ) : zypp::TriBool( zypp::indeterminate ) ); }
+
+  }
+
+  bool HostCapabilityCache::Capabilities::sameValues( const Capabilities &rhs ) const
+  {
+    return sameTriboolState( _metalink, rhs._metalink )
+        && sameTriboolState( _ranges, rhs._ranges )
+        && _maxRanges == rhs._maxRanges;
+  }
+
+  HostCapabilityCache::HostCapabilityCache( zypp::Pathname cacheDir_r, std::chrono::seconds ttl_r )
+    : _cacheDir( std::move(cacheDir_r) )
+    , _ttl( ttl_r )
+  {}
+
+  void HostCapabilityCache::setCacheDir( zypp::Pathname cacheDir_r )
+  {
+    _cacheDir = std::move(cacheDir_r);
+  }
+
+  std::optional<HostCapabilityCache::Capabilities> HostCapabilityCache::lookup( const Url &url_r )
+  {
+    const HostEntries &entries { hostEntries( hostKey( url_r ) ) };
+    if ( entries.empty() )
+      return {};
+
+    const time_t minUpdated { ::time( nullptr ) - _ttl.count() };
+    std::string dir { dirKey( url_r ) };
+    while ( true ) {
+      if ( const auto it = entries.find( dir ); it != entries.end() && it->second._updated >= minUpdated )
+        return it->second;
+      if ( dir.size() == 1 )
+        break;
+      dir.erase( dir.rfind( '/', dir.size() - 2 ) + 1 );  // parent dir
+    }
+    return {};
+  }
+
+  void HostCapabilityCache::update( const Url &url_r, const std::function<void( Capabilities & )> &fnc_r )
+  {
+    const std::string &host { hostKey( url_r ) };
+    HostEntries &entries { hostEntries( host ) };
+
+    Capabilities &caps { entries[dirKey( url_r )] };
+    const Capabilities old { caps };
+    fnc_r( caps );
+    caps._updated = ::time( nullptr );
+
+    // refresh the file if half of the TTL passed, so the entry does not expire on disk
+    if ( ! caps.sameValues( old ) || old._updated < caps._updated - _ttl.count() / 2 )
+      persist( host, entries );
+  }
+
+  void HostCapabilityCache::invalidate( const Url &url_r )
+  {
+    const std::string &host { hostKey( url_r ) };
+    HostEntries &entries { hostEntries( host ) };
+
+    // the entry used by lookup may belong to any parent dir
+    const std::string &dir { dirKey( url_r ) };
+    bool changed = false;
+    for ( auto it = entries.begin(); it != entries.end(); ) {
+      if ( zypp::strv::hasPrefix( dir, it->first ) ) {
+        it = entries.erase( it );
+        changed = true;
+      } else
+        ++it;
+    }
+    if ( changed )
+      persist( host, entries );
+  }
+
+  HostCapabilityCache::HostEntries &HostCapabilityCache::hostEntries( const std::string &hostKey_r )
+  {
+    if ( const auto it = _hosts.find( hostKey_r ); it != _hosts.end() )
+      return it->second;
+
+    HostEntries &entries { _hosts[hostKey_r] };
+    if ( _cacheDir.empty() )
+      return entries;
+
+    // <dir> <updated> <metalink> <ranges> <maxRanges>
+    std::ifstream in( ( _cacheDir / hostKey_r ).c_str() );
+    std::string line;
+    while ( std::getline( in, line ) ) {
+      std::string_view words[5];
+      if ( zypp::strv::split( line, [&words]( std::string_view word_r, unsigned idx_r ) {
+             if ( idx_r < 5 ) words[idx_r] = word_r;
+           } ) != 5 || words[0].empty() || words[0].back() != '/' ) {
+        WAR << "Ignoring malformed line in " << ( _cacheDir / hostKey_r ) << ": " << line << std::endl;
+        continue;
+      }
+      Capabilities &caps { entries[std::string(words[0])] };
+      caps._updated   = zypp::strv::strtonum<time_t>( words[1] );
+      caps._metalink  = triBoolFrom( words[2] );
+      caps._ranges    = triBoolFrom( words[3] );
+      caps._maxRanges = zypp::strv::strtonum<unsigned>( words[4] );
+    }
+    return entries;
+  }
+
+  void HostCapabilityCache::persist( const std::string &hostKey_r, const HostEntries &entries_r ) const
+  {
+    if ( _cacheDir.empty() )
+      return;
+
+    if ( zypp::filesystem::assert_dir( _cacheDir ) != 0 ) {
+      DBG << "Can not create " << _cacheDir << ", keeping host capabilities in memory only." << std::endl;
+      return;
+    }
+
+    const zypp::Pathname file { _cacheDir / hostKey_r };
+    zypp::filesystem::TmpFile tmp { zypp::filesystem::TmpFile::makeSibling( file, 0644 ) };
+    if ( ! tmp )
+      return;
+    {
+      std::ofstream out( tmp.path().c_str() );
+      for ( const auto &[dir, caps] : entries_r ) {
+        out << dir << " " << caps._updated
+            << " " << asString( caps._metalink )
+            << " " << asString( caps._ranges ? caps._ranges : zypp::TriBool( zypp::indeterminate ) ) // failures are memory only
+            << " " << caps._maxRanges << "\n";
+      }
+      if ( ! out.good() )
+        return;
+    }
+    if ( zypp::filesystem::rename( tmp.path(), file ) == 0 )
+      tmp.autoCleanup( false );
+  }
+
+}
@@ -313,6 +313,20 @@ void NetworkRequestDispatcherPrivate::setFinished( NetworkRequest &req, NetworkR
 
   req.d_func()->_dispatcher = nullptr;
 
+  if ( rmode && easyHandle && !result.isError() ) {
+    long numConnects = -1;
+    if ( curl_easy_getinfo( easyHandle, CURLINFO_NUM_CONNECTS, &numConnects ) == CURLE_OK && numConnects == 0 )
+      _stats._reusedConnections++;
+
+    // HTTP/1.x can not multiplex, give the free slot to the next request to the same host
+    // so it is sent over the kept-alive connection right away
+    long httpVersion = 0;
+    if ( curl_easy_getinfo( easyHandle, CURLINFO_HTTP_VERSION, &httpVersion ) == CURLE_OK
+         && ( httpVersion == CURL_HTTP_VERSION_1_0 || httpVersion == CURL_HTTP_VERSION_1_1 ) ) {
+      _warmConnections.push_back( WarmConnection{ hostKey( req.url() ), req.d_func()->_batchSize } );
+    }
+  }
+
   //first set the result, the Request might have a checksum to check as well so a currently
   //successful request could fail later on
   req.d_func()->setResult( std::move(result) );
@@ -332,6 +346,30 @@ bool NetworkRequestDispatcherPrivate::addRequestToMultiHandle(NetworkRequest &re
   return true;
 }
 
+std::string NetworkRequestDispatcherPrivate::hostKey( const Url &url )
+{
+  return url.getScheme() + "://" + url.getHost() + ":" + url.getPort();
+}
+
+std::deque< std::shared_ptr<NetworkRequest> >::iterator NetworkRequestDispatcherPrivate::nextPending( WarmConnection &warm )
+{
+  if ( warm._hostKey.empty() )
+    return _pendingDownloads.end();
+
+  // never overtake a request with a higher priority
+  const auto prio = _pendingDownloads.front()->priority();
+  auto it = std::find_if( _pendingDownloads.begin(), _pendingDownloads.end(), [&]( const auto &pendingReq ){
+    return pendingReq->priority() >= prio && hostKey( pendingReq->url() ) == warm._hostKey;
+  });
+
+  // a long run would starve the other hosts, give the slot to the head of the queue
+  if ( it != _pendingDownloads.end() && warm._batchSize >= _maxBatchSize ) {
+    _stats._batchesCapped++;
+    return _pendingDownloads.end();
+  }
+  return it;
+}
+
 void NetworkRequestDispatcherPrivate::dequeuePending()
 {
   if ( !_isRunning || _locked )
@@ -341,8 +379,27 @@ void NetworkRequestDispatcherPrivate::dequeuePending()
     if ( !_pendingDownloads.size() )
       break;
 
-    std::shared_ptr<NetworkRequest> req = std::move( _pendingDownloads.front() );
-    _pendingDownloads.pop_front();
+    WarmConnection warm;
+    if ( _warmConnections.size() ) {
+      warm = std::move( _warmConnections.front() );
+      _warmConnections.pop_front();
+    }
+
+    unsigned batchSize = 1;
+    auto it = nextPending( warm );
+    if ( it != _pendingDownloads.end() ) {
+      batchSize = warm._batchSize + 1;
+      _stats._coalesced++;
+      if ( batchSize == 2 )
+        _stats._batches++;
+    } else {
+      it = _pendingDownloads.begin();
+    }
+    _stats._maxBatchSize = std::max( _stats._maxBatchSize, batchSize );
+
+    std::shared_ptr<NetworkRequest> req = std::move( *it );
+    _pendingDownloads.erase( it );
+    req->d_func()->_batchSize = batchSize;
 
     std::string errBuf = "Failed to initialize easy handle";
     if ( !req->d_func()->initialize( errBuf ) ) {
@@ -355,15 +412,22 @@ void NetworkRequestDispatcherPrivate::dequeuePending()
       continue;
 
     req->d_func()->aboutToStart();
+    _stats._started++;
     _sigDownloadStarted.emit( *z_func(), *req );
 
     _runningDownloads.push_back( std::move(req) );
   }
 
+  // slots not taken right away are not warm anymore
+  _warmConnections.clear();
+
   //check for empty queues
   if ( _pendingDownloads.size() == 0 && _runningDownloads.size() == 0 ) {
     //once we finished all requests, cancel the timer too, so curl is not called without requests
     _timer->stop();
+    DBG << "Dispatched " << _stats._started << " requests, " << _stats._coalesced << " on warm connections in "
+        << _stats._batches << " batches (max " << _stats._maxBatchSize << ", " << _stats._batchesCapped << " capped), "
+        << _stats._reusedConnections << " reused a connection." << std::endl;
     _sigQueueFinished.emit( *z_func() );
   }
 }
@@ -405,6 +469,16 @@ int NetworkRequestDispatcher::maximumConcurrentConnections () const
   return d_func()->_maxConnections;
 }
 
+void NetworkRequestDispatcher::setMaximumBatchSize( const unsigned maxBatch )
+{
+  d_func()->_maxBatchSize = std::max( maxBatch, 1U );
+}
+
+unsigned NetworkRequestDispatcher::maximumBatchSize () const
+{
+  return d_func()->_maxBatchSize;
+}
+
 void NetworkRequestDispatcher::enqueue(const std::shared_ptr<NetworkRequest> &req )
 {
   if ( !req )
@@ -524,6 +598,11 @@ const zyppng::NetworkRequestError &NetworkRequestDispatcher::lastError() const
   return d_func()->_lastError;
 }
 
+const NetworkRequestDispatcher::Statistics &NetworkRequestDispatcher::statistics() const
+{
+  return d_func()->_stats;
+}
+
 SignalProxy<void (NetworkRequestDispatcher &, NetworkRequest &)> NetworkRequestDispatcher::sigDownloadStarted()
 {
   return d_func()->_sigDownloadStarted;
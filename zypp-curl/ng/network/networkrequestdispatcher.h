@@ -101,6 +101,18 @@ namespace zyppng {
        */
       int maximumConcurrentConnections () const;
 
+      /*!
+       * Change the maximum number of requests to the same host that are started
+       * back to back on a warm connection, the default is 16. Afterwards the slot is
+       * given to the head of the queue, so other hosts are not starved.
+       */
+      void setMaximumBatchSize ( const unsigned maxBatch );
+
+      /**
+       * returns the maximum number of requests started back to back on a warm connection
+       */
+      unsigned maximumBatchSize () const;
+
       /*!
        * Enqueues a new \a request and puts it into the waiting queue. If the dispatcher
        * is already running and has free capacatly the request might be started right away
@@ -166,6 +178,28 @@ namespace zyppng {
        */
       const NetworkRequestError &lastError() const;
 
+      /*!
+       * Counters about how requests were dispatched.
+       *
+       * When a HTTP/1.x request finishes, the next pending request to the same host with at least
+       * the same priority is started instead of the head of the queue. This way it can reuse the
+       * kept-alive connection and many small files are fetched back to back without a new connection
+       * setup for each of them. Such a run of requests is called a batch.
+       */
+      struct Statistics {
+        size_t   _started = 0;           //< requests that were started
+        size_t   _coalesced = 0;         //< requests that were started on a warm connection to the same host
+        size_t   _reusedConnections = 0; //< finished requests that did not need to open a new connection
+        size_t   _batches = 0;           //< runs of at least 2 requests to the same host
+        unsigned _maxBatchSize = 0;      //< the longest run of requests to the same host
+        size_t   _batchesCapped = 0;     //< runs ended by the batch size limit although more requests to the host were queued
+      };
+
+      /*!
+       * Returns the dispatch statistics since the dispatcher was created.
+       */
+      const Statistics &statistics() const;
+
       /*!
        * Signal is emitted when a download is started
        */
@@ -110,6 +110,7 @@ namespace zyppng {
     Signal< void ( Downloader &parent, Download& download )> _sigFinished;
     Signal< void ( Downloader &parent )> _queueEmpty;
     std::shared_ptr<MirrorControl> _mirrors;
+    HostCapabilityCache::Ptr _hostCaps;
   };
 
 }
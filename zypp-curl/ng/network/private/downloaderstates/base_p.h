@@ -23,6 +23,7 @@
 #include <zypp-curl/ng/network/request.h>
 #include <zypp-curl/ng/network/TransferSettings>
 #include <zypp-curl/ng/network/private/mirrorcontrol_p.h>
+#include <zypp-curl/ng/network/private/hostcapabilities_p.h>
 #include <zypp-curl/ng/network/networkrequesterror.h>
 #include <zypp-media/auth/CredentialManager>
 
@@ -92,6 +93,7 @@ namespace zyppng {
 
     std::shared_ptr<NetworkRequestDispatcher> _requestDispatcher;
     std::shared_ptr<MirrorControl> _mirrorControl;
+    HostCapabilityCache::Ptr _hostCaps; //< what we know about the servers, shared by all downloads of a Downloader
 
     zypp::media::CredentialManager::CredentialSet _credCache; //< the credential cache for this download
 
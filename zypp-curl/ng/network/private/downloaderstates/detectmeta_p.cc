@@ -67,6 +67,9 @@ namespace zyppng {
       if ( req.lastRedirectInfo ().size () )
         WAR << req.nativeHandle() << " Last redirection target was: " << req.lastRedirectInfo () << std::endl;
 
+      // maybe the server changed, probe it again next time
+      stateMachine()._hostCaps->invalidate( stateMachine()._spec.url() );
+
       _error = err;
       _gotMetalink = false;
       return _sigFinished.emit();
@@ -75,6 +78,12 @@ namespace zyppng {
     std::string cType = req.contentType();
     _gotMetalink = ( cType.find("application/metalink+xml") == 0 || cType.find("application/metalink4+xml") == 0 );
     MIL << req.nativeHandle() << " " << "Metalink detection result on url " << req.url() << " is " << _gotMetalink << std::endl;
+    // only remember the positive answer, small files are served directly even by metalink capable servers
+    if ( _gotMetalink ) {
+      stateMachine()._hostCaps->update( stateMachine()._spec.url(), []( HostCapabilityCache::Capabilities &caps ) {
+        caps._metalink = true;
+      });
+    }
     _sigFinished.emit();
   }
 
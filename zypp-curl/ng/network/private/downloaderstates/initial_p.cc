@@ -37,6 +37,11 @@ namespace zyppng {
     if ( spec.metalinkEnabled() ) {
 #if ENABLE_ZCHUNK_COMPRESSION
       if ( deltaZck && spec.headerSize() > 0 ) {
+        // skip the detection round trip if we already know the server
+        if ( const auto caps = sm._hostCaps->lookup( spec.url() ); caps && caps->_metalink ) {
+          MIL_MEDIA << "Server is known to serve metalink, going to download metalink directly." << std::endl;
+          return _sigTransitionToDlMetaLinkInfoState.emit();
+        }
         MIL_MEDIA << "We might have a zck file, detecting metalink first" << std::endl;
         return _sigTransitionToDetectMetalinkState.emit();
       }
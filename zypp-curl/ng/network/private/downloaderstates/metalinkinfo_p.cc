@@ -65,7 +65,14 @@ namespace zyppng {
       return BasicDownloaderStateBase::gotFinished();
     }
 
+    // only remember the positive answer, small files are served directly even by metalink capable servers
     auto &sm = stateMachine();
+    if ( _detectedMetaType == MetaDataType::MetaLink ) {
+      sm._hostCaps->update( sm._spec.url(), []( HostCapabilityCache::Capabilities &caps ) {
+        caps._metalink = true;
+      });
+    }
+
     if ( sm._stopOnMetalink ) {
       MIL << "Stopping after receiving MetaData as requested" << std::endl;
       sm._stoppedOnMetalink = true;
@@ -66,6 +66,15 @@ namespace zyppng {
     const auto &rngs = reqLocked->requestedRanges();
     std::for_each( rngs.begin(), rngs.end(), [&req]( const auto &b ){ DBG_MEDIA  << req.nativeHandle() << " " << "-> Block " << b.start << " finished." << std::endl; } );
 
+    // remember how many ranges the server accepted, reused requests and the next download start with that
+    if ( const unsigned batchSize = reqLocked->lastRangeBatchSize(); batchSize > 1 && rngs.size() > 1 ) {
+      reqLocked->setMaxRangeBatchSize( batchSize );
+      stateMachine()._hostCaps->update( reqLocked->_originalUrl, [batchSize]( HostCapabilityCache::Capabilities &caps ) {
+        caps._ranges = true;
+        caps._maxRanges = batchSize;
+      });
+    }
+
     auto restartReqWithBlock = [ this ]( std::shared_ptr<Request> &req, std::vector<Block> &&blocks ) {
       MIL  << req->nativeHandle() << " " << "Reusing Request to download blocks:"<<std::endl;
       if ( !addBlockRanges( req, std::move( blocks ) ) )
@@ -121,6 +130,14 @@ namespace zyppng {
       if ( req->lastRedirectInfo ().size () )
         MIL << req->nativeHandle() << " Last redirection target was: " << req->lastRedirectInfo () << std::endl;
 
+      // this server can not do ranges, skip it until the entry expires
+      if ( err.type() == NetworkRequestError::RangeFail ) {
+        parent._hostCaps->update( req->_originalUrl, []( HostCapabilityCache::Capabilities &caps ) {
+          caps._ranges = false;
+          caps._maxRanges = 0;
+        });
+      }
+
       NetworkRequestError dummyErr;
 
       const auto &fRanges = req->failedRanges();
@@ -224,6 +241,14 @@ namespace zyppng {
       return;
     }
 
+    const auto &caps = parent._hostCaps->lookup( myUrl );
+    if ( caps && !caps->_ranges ) {
+      MIL << "Mirror " << myUrl << " is known to not support range requests, dropping it from the list of mirrors." << std::endl;
+      _fileMirrors.erase( mirror.first );
+      ensureDownloadsRunning();
+      return;
+    }
+
     auto blocks = getNextBlocks( myUrl.getScheme() );
     if ( !blocks.size() )
       blocks = getNextFailedBlocks( myUrl.getScheme() );
@@ -243,6 +268,14 @@ namespace zyppng {
     req->setPriority( parent._defaultSubRequestPriority );
     req->transferSettings() = settings;
 
+    // lets the request preallocate the target file
+    if ( _fileSize > 0 )
+      req->setExpectedFileSize( _fileSize );
+
+    // do not probe for the max nr of ranges again if we know it already
+    if ( caps && caps->_maxRanges > 0 )
+      req->setMaxRangeBatchSize( caps->_maxRanges );
+
     // if we download chunks we do not want to wait for too long on mirrors that have slow activity
     // note: this sets the activity timeout, not the download timeout
     req->transferSettings().setTimeout( 2 );
@@ -0,0 +1,99 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+----------------------------------------------------------------------/
+*
+* This file contains private API, this might break at any time between releases.
+* You have been warned!
+*
+*/
+#ifndef ZYPP_CURL_NG_NETWORK_PRIVATE_HOSTCAPABILITIES_P_H
+#define ZYPP_CURL_NG_NETWORK_PRIVATE_HOSTCAPABILITIES_P_H
+
+#include <zypp-core/zyppng/core/Url>
+#include <zypp-core/Pathname.h>
+#include <zypp-core/TriBool.h>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+
+namespace zyppng {
+
+  /*!
+   * Remembers what a server offers below an URL prefix, so the downloader
+   * does not need to probe for it on every file:
+   * whether metalink files are served when asked for via the \c Accept header,
+   * whether range requests work and how many ranges fit into one multipart request.
+   *
+   * Entries are kept per host and directory of the downloaded file. A lookup
+   * returns the entry of the closest parent directory that was updated within
+   * the TTL. If a cache directory is set, entries are persisted there, one file per host.
+   * If it can not be written the cache silently works in memory only.
+   * A failed range request may have been a temporary server problem, so
+   * this is never persisted and just remembered for this process.
+   */
+  class HostCapabilityCache
+  {
+  public:
+    struct Capabilities {
+      zypp::TriBool _metalink = zypp::indeterminate;  //< metalink served on request, the downloader records true only
+      zypp::TriBool _ranges   = zypp::indeterminate;  //< range requests work, false is not persisted
+      unsigned _maxRanges     = 0;                    //< max ranges per request known to work, 1 means no multipart, 0 if unknown
+      time_t   _updated       = 0;
+
+      /** Same capabilities, ignoring \ref _updated. */
+      bool sameValues( const Capabilities &rhs ) const;
+    };
+
+    using Ptr = std::shared_ptr<HostCapabilityCache>;
+
+    static constexpr std::chrono::seconds defaultTtl = std::chrono::hours( 24 );
+
+    HostCapabilityCache( zypp::Pathname cacheDir_r = zypp::Pathname(), std::chrono::seconds ttl_r = defaultTtl );
+
+    /*!
+     * Directory to persist the entries in, an empty path keeps them in memory only.
+     * Already loaded entries are kept.
+     */
+    void setCacheDir( zypp::Pathname cacheDir_r );
+    const zypp::Pathname &cacheDir() const
+    { return _cacheDir; }
+
+    /*!
+     * The known capabilities for \a url_r, if there is an entry not older than the TTL.
+     */
+    std::optional<Capabilities> lookup( const Url &url_r );
+
+    /*!
+     * Let \a fnc_r update the entry for the directory of \a url_r and store it.
+     * The cache file is just rewritten if a value changed or the persisted
+     * entry is about to expire.
+     */
+    void update( const Url &url_r, const std::function<void( Capabilities & )> &fnc_r );
+
+    /*!
+     * Forget everything known about \a url_r, so it is probed again.
+     */
+    void invalidate( const Url &url_r );
+
+  private:
+    using HostEntries = std::map<std::string, Capabilities>; //< directory -> capabilities
+
+    HostEntries &hostEntries( const std::string &hostKey_r );
+    void persist( const std::string &hostKey_r, const HostEntries &entries_r ) const;
+
+    zypp::Pathname _cacheDir;
+    std::chrono::seconds _ttl;
+    std::unordered_map<std::string, HostEntries> _hosts;
+  };
+
+}
+
+#endif
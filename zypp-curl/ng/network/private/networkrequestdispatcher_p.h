@@ -34,6 +34,7 @@ public:
   ~NetworkRequestDispatcherPrivate() override;
 
   int _maxConnections = 10;
+  unsigned _maxBatchSize = 16;
 
   std::deque< std::shared_ptr<NetworkRequest> > _pendingDownloads;
   std::vector< std::shared_ptr<NetworkRequest> > _runningDownloads;
@@ -46,6 +47,17 @@ public:
   CURLM *_multi = nullptr;
 
   NetworkRequestError _lastError;
+  NetworkRequestDispatcher::Statistics _stats;
+
+  /*!
+   * A slot freed by a HTTP/1.x request, its connection is still open.
+   * Consumed by the next call to \ref dequeuePending.
+   */
+  struct WarmConnection {
+    std::string _hostKey;
+    unsigned _batchSize = 1; //< nr of requests that ran back to back on it
+  };
+  std::deque<WarmConnection> _warmConnections;
 
   std::string _userAgent;
   std::unordered_map< std::string, std::unordered_map<std::string, std::string> > _customHeaders;
@@ -71,6 +83,8 @@ private:
 
   void handleMultiSocketAction ( curl_socket_t nativeSocket, int evBitmask );
   void dequeuePending ();
+  std::deque< std::shared_ptr<NetworkRequest> >::iterator nextPending ( WarmConnection &warm );
+  static std::string hostKey ( const Url &url );
 };
 }
 
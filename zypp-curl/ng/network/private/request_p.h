@@ -108,6 +108,7 @@ namespace zyppng {
     TransferSettings                    _settings;
     NetworkRequest::Options             _options;
     zypp::ByteCount                     _expectedFileSize; // the file size as expected by the user code
+    unsigned                            _maxRangeBatchSize = 0; // max nr of ranges requested at once, 0 means no limit
     std::vector<NetworkRequest::Range>  _requestedRanges; ///< the requested ranges that need to be downloaded
 
     struct FileVerifyInfo {
@@ -124,6 +125,7 @@ namespace zyppng {
 
     void *_easyHandle = nullptr; // the easy handle that controlling this request
     NetworkRequestDispatcher *_dispatcher = nullptr; // the parent downloader owning this request
+    unsigned _batchSize = 1; // set by the dispatcher, position in a run of requests to the same host
 
     //signals
     Signal< void ( NetworkRequest &req )> _sigStarted;
@@ -151,7 +153,7 @@ namespace zyppng {
     struct prepareNextRangeBatch_t
     {
       prepareNextRangeBatch_t( running_t &&prevState );
-      zypp::AutoFILE _outFile;     //the file we are writing to
+      zypp::AutoFD _outFile;       //the file we are writing to
       off_t _downloaded       = 0; //downloaded bytes
       std::unique_ptr<CurlMultiPartHandler> _partialHelper = {};
     };
@@ -162,7 +164,7 @@ namespace zyppng {
 
       Timer::Ptr _activityTimer = Timer::create();
 
-      zypp::AutoFILE _outFile;
+      zypp::AutoFD _outFile;       //written via pwrite, no shared file position
       std::unique_ptr<CurlMultiPartHandler> _partialHelper = {};
 
       // handle the case when cancel() is called from a slot to the progress signal
@@ -182,6 +184,7 @@ namespace zyppng {
     struct finished_t {
       off_t               _downloaded = 0; //downloaded bytes
       zypp::ByteCount     _contentLenght = 0; // the content length as reported by the server
+      unsigned            _rangeBatchSize = 0; // nr of ranges requested at once, 0 if no ranges were requested
       NetworkRequestError _result; // the overall result of the download
     };
 
@@ -346,6 +346,8 @@ namespace zyppng {
                   , *this
             );
             helper = initState->_partialHelper.get();
+            if ( _maxRangeBatchSize > 0 )
+              helper->setMaxRangeBatchSize( _maxRangeBatchSize );
 
           } else if ( auto pendingState = std::get_if<prepareNextRangeBatch_t>(&_runningMode) ) {
             helper = pendingState->_partialHelper.get();
@@ -378,23 +380,26 @@ namespace zyppng {
       return false;
     }
     // if we have no open file create or open it
-    if ( !rmode->_outFile ) {
-      std::string openMode = "w+b";
-      if ( _fMode == NetworkRequest::WriteShared )
-        openMode = "r+b";
+    if ( rmode->_outFile == -1 ) {
+      // in shared mode other requests write into the same file, so never truncate it
+      int openFlags = O_RDWR | O_CREAT | O_CLOEXEC;
+      if ( _fMode != NetworkRequest::WriteShared )
+        openFlags |= O_TRUNC;
 
-      rmode->_outFile = fopen( _targetFile.asString().c_str() , openMode.c_str() );
+      rmode->_outFile = zypp::AutoFD( ::open( _targetFile.c_str(), openFlags, 0666 ) );
 
-      //if the file does not exist create a new one
-      if ( !rmode->_outFile && _fMode == NetworkRequest::WriteShared ) {
-        rmode->_outFile = fopen( _targetFile.asString().c_str() , "w+b" );
-      }
-
-      if ( !rmode->_outFile ) {
+      if ( rmode->_outFile == -1 ) {
         rmode->_cachedResult = NetworkRequestErrorPrivate::customError(  NetworkRequestError::InternalError
           ,zypp::str::Format("Unable to open target file (%1%). Errno: (%2%:%3%)") % _targetFile.asString() % errno % strerr_cxx() );
         return false;
       }
+
+      // reserve the space for the whole file up front, so stripes arriving out of
+      // order do not fragment it. KEEP_SIZE: the file size still grows with the data written.
+      if ( _expectedFileSize > 0 ) {
+        if ( ::fallocate( rmode->_outFile, FALLOC_FL_KEEP_SIZE, 0, _expectedFileSize ) != 0 && errno != EOPNOTSUPP && errno != ENOSYS )
+          DBG << _easyHandle << " " << "Unable to preallocate " << _expectedFileSize << " for " << _targetFile << ": " << strerr_cxx() << std::endl;
+      }
     }
 
     return true;
@@ -494,6 +499,8 @@ namespace zyppng {
       auto &rmode = std::get<running_t>( _runningMode );
       resState._downloaded = rmode._downloaded;
       resState._contentLenght = rmode._contentLenght;
+      if ( rmode._partialHelper )
+        resState._rangeBatchSize = rmode._partialHelper->rangeBatchSize();
 
       if ( resState._result.type() == NetworkRequestError::NoError && !(_options & NetworkRequest::HeadRequest) && !(_options & NetworkRequest::ConnectionTest) ) {
         if ( _requestedRanges.size( ) ) {
@@ -505,14 +512,16 @@ namespace zyppng {
 
           // if we have ranges we need to fill our digest from the full file
           if ( _fileVerification && resState._result.type() == NetworkRequestError::NoError ) {
-            if ( fseek( rmode._outFile, 0, SEEK_SET ) != 0 ) {
-              resState._result = NetworkRequestErrorPrivate::customError(  NetworkRequestError::InternalError, "Unable to set output file pointer." );
-            } else {
-              constexpr size_t bufSize = 4096;
-              char buf[bufSize];
-              while( auto cnt = fread(buf, 1, bufSize, rmode._outFile ) > 0 ) {
-                _fileVerification->_fileDigest.update(buf, cnt);
-              }
+            constexpr size_t bufSize = 16384;
+            char buf[bufSize];
+            off_t readOffset = 0;
+            ssize_t cnt = 0;
+            while( ( cnt = zyppng::eintrSafeCall( ::pread, rmode._outFile.value(), buf, bufSize, readOffset ) ) > 0 ) {
+              _fileVerification->_fileDigest.update( buf, cnt );
+              readOffset += cnt;
+            }
+            if ( cnt < 0 ) {
+              resState._result = NetworkRequestErrorPrivate::customError(  NetworkRequestError::InternalError, "Unable to read back the output file." );
             }
           }
         } // if ( _requestedRanges.size( ) )
@@ -531,7 +540,7 @@ namespace zyppng {
         }
       }
 
-      rmode._outFile.reset();
+      rmode._outFile = zypp::AutoFD();
     }
 
     _runningMode = std::move( resState );
@@ -679,12 +688,7 @@ namespace zyppng {
       return 0;
 
     if ( offset ) {
-      // seek to the given offset
-      if ( fseek( rmode._outFile, *offset, SEEK_SET ) != 0 ) {
-        rmode._cachedResult = NetworkRequestErrorPrivate::customError(  NetworkRequestError::InternalError,
-          "Unable to set output file pointer." );
-        return 0;
-      }
+      // the data goes to the given offset, written by pwrite below
       rmode._currentFileOffset = *offset;
     }
 
@@ -697,12 +701,18 @@ namespace zyppng {
     }
 
     //make sure we do not write after the expected file size
-    if ( _expectedFileSize && _expectedFileSize <= static_cast<zypp::ByteCount::SizeType>( rmode._currentFileOffset + max) ) {
+    if ( _expectedFileSize && _expectedFileSize < static_cast<zypp::ByteCount::SizeType>( rmode._currentFileOffset + max) ) {
       rmode._cachedResult = NetworkRequestErrorPrivate::customError(  NetworkRequestError::InternalError, "Downloaded data exceeds expected length." );
       return 0;
     }
 
-    auto written = fwrite( data, 1, max, rmode._outFile );
+    size_t written = 0;
+    while ( written < max ) {
+      const auto res = zyppng::eintrSafeCall( ::pwrite, rmode._outFile.value(), data + written, max - written, rmode._currentFileOffset + written );
+      if ( res <= 0 )
+        break;
+      written += res;
+    }
     if ( written == 0 )
       return 0;
 
@@ -755,6 +765,18 @@ namespace zyppng {
     d_func()->_expectedFileSize = std::move( expectedFileSize );
   }
 
+  void NetworkRequest::setMaxRangeBatchSize( unsigned maxRanges )
+  {
+    d_func()->_maxRangeBatchSize = maxRanges;
+  }
+
+  unsigned NetworkRequest::lastRangeBatchSize() const
+  {
+    if ( const auto fin = std::get_if<NetworkRequestPrivate::finished_t>( &d_func()->_runningMode ) )
+      return fin->_rangeBatchSize;
+    return 0;
+  }
+
   void NetworkRequest::setPriority( NetworkRequest::Priority prio, bool triggerReschedule )
   {
     Z_D();
@@ -894,7 +916,7 @@ namespace zyppng {
       return {};
 
     const auto &rmode = std::get<NetworkRequestPrivate::running_t>( d->_runningMode );
-    return zypp::io::peek_data_fd( rmode._outFile, offset, count );
+    return zypp::io::peek_data_fd( rmode._outFile.value(), offset, count );
   }
 
   Url NetworkRequest::url() const
@@ -96,9 +96,25 @@ namespace zyppng {
      * Sets the expected file size for the download.
      * In case of a Multi-Range-Download the \a NetworkRequest will check if the download
      * would write behind the expectedFileSize and fail.
+     * The target file is preallocated to this size, so stripes of the same file written
+     * by concurrent requests do not fragment it.
      */
     void setExpectedFileSize ( zypp::ByteCount expectedFileSize );
 
+    /*!
+     * Limits the nr of ranges requested at once in a Multi-Range-Download to \a maxRanges.
+     * By default the request starts with a high number and lowers it if the server can not
+     * handle it, if the limit of the server is already known this saves the failing attempts.
+     * 0 means no limit.
+     */
+    void setMaxRangeBatchSize ( unsigned maxRanges );
+
+    /*!
+     * Returns the nr of ranges that were requested at once in the last Multi-Range-Download,
+     * or 0 if no ranges were downloaded.
+     */
+    unsigned lastRangeBatchSize () const;
+
     /*!
      * Sets the priority of the NetworkRequest, this will affect where
      * the \sa NetworkRequestDispatcher puts the Request in the Queue.
@@ -56,5 +56,12 @@ namespace zypp {
     bool ProxyInfo::useProxyFor( const Url & url_r ) const
     { return _pimpl->useProxyFor( url_r ); }
 
+    void ProxyInfo::prefetch( const Url & url_r )
+    {
+#ifdef WITH_LIBPROXY_SUPPORT
+      ProxyInfoLibproxy::prefetch( url_r );
+#endif
+    }
+
   } // namespace media
 } // namespace zypp
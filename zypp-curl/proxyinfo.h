@@ -52,6 +52,13 @@ namespace zypp {
       /** Return \c true if  \ref enabled and \a url_r does not match \ref noProxy. */
       bool useProxyFor( const Url & url_r ) const;
 
+      /** Hint that \a url_r will be accessed soon.
+       * Implementations which need to evaluate a PAC script may start
+       * doing so in the background, so setting up the transfer later
+       * does not block. No-op for the others.
+       */
+      static void prefetch( const Url & url_r );
+
     private:
       /** Pointer to implementation */
       RW_pointer<Impl> _pimpl;
@@ -11,8 +11,12 @@
 */
 
 #include <zypp-core/AutoDispose.h>
+#include <chrono>
+#include <future>
 #include <iostream>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 
 #include <zypp-core/base/Logger.h>
 #include <zypp-core/base/String.h>
@@ -102,6 +106,106 @@ namespace zypp {
       }
     }
 
+    namespace {
+
+      ///////////////////////////////////////////////////////////////////
+      /// \class ProxyCache
+      /// \brief Process wide cache of libproxy results per scheme+host+port.
+      ///
+      /// Asking libproxy may evaluate a PAC script or even download it
+      /// (WPAD), so each lookup is done just once per host and \ref TTL.
+      /// The evaluation runs on a worker thread; concurrent lookups for the
+      /// same host share it. \ref prefetch starts it without waiting for
+      /// the result.
+      ///////////////////////////////////////////////////////////////////
+      class ProxyCache
+      {
+      public:
+        static constexpr std::chrono::seconds TTL { 300 };
+
+        static ProxyCache & instance()
+        {
+          static ProxyCache _instance;
+          return _instance;
+        }
+
+        /** The proxy to use for \a url_r (may block until the evaluation is done). */
+        std::string get( pxProxyFactoryType * factory_r, const Url & url_r )
+        { return lookup( factory_r, url_r ).get(); }
+
+        /** Start evaluating the proxy for \a url_r unless it is cached. */
+        void prefetch( pxProxyFactoryType * factory_r, const Url & url_r )
+        { lookup( factory_r, url_r ); }
+
+        /** Drop all entries (waits for running evaluations). */
+        void clear()
+        {
+          std::unordered_map<std::string,Entry> dropped;
+          {
+            std::lock_guard<std::mutex> guard( _mutex );
+            dropped.swap( _cache );
+          }
+          for ( auto & el : dropped )
+            el.second._result.wait();
+        }
+
+      private:
+        struct Entry
+        {
+          std::shared_future<std::string> _result;
+          std::chrono::steady_clock::time_point _expires;
+        };
+
+        std::shared_future<std::string> lookup( pxProxyFactoryType * factory_r, const Url & url_r )
+        {
+          std::string key { url_r.asString( url::ViewOption::WITH_SCHEME + url::ViewOption::WITH_HOST + url::ViewOption::WITH_PORT ) };
+          const auto now { std::chrono::steady_clock::now() };
+
+          std::lock_guard<std::mutex> guard( _mutex );
+          Entry & entry { _cache[key] };
+          if ( ! entry._result.valid() || entry._expires <= now )
+          {
+            DBG << "Evaluating proxy for " << key << endl;
+            entry._result  = std::async( std::launch::async, &ProxyCache::evaluate, factory_r, key ).share();
+            entry._expires = now + TTL;
+          }
+          return entry._result;
+        }
+
+        /** Ask libproxy (runs on the worker thread). */
+        static std::string evaluate( pxProxyFactoryType * factory_r, const std::string & url_r );
+
+      private:
+        std::mutex _mutex;
+        std::unordered_map<std::string,Entry> _cache;
+      };
+
+      std::string ProxyCache::evaluate( pxProxyFactoryType * factory_r, const std::string & url_r )
+      {
+        auto api = proxyApi();
+        if ( !api )
+          return "";
+
+        zypp::AutoDispose<char **> proxies(
+              api->getProxies( factory_r, url_r.c_str() )
+              , api->freeProxies
+        );
+        if ( !proxies.value() )
+                return "";
+
+        /* cURL can only handle HTTP proxies, not SOCKS. And can only handle
+           one. So look through the list and find an appropriate one. */
+        std::optional<std::string> result;
+        for (int i = 0; proxies[i]; i++) {
+          if ( !result && !strncmp(proxies[i], "http://", 7) ) {
+            result = str::asString( proxies[i] );
+          }
+        }
+
+        return result.value_or( "" );
+      }
+    } // namespace
+
     struct TmpUnsetEnv
     {
       TmpUnsetEnv(const char *var_r) : _set(false), _var(var_r) {
@@ -143,7 +247,10 @@ namespace zypp {
       {
         MIL << "Build Libproxy Factory from /etc/sysconfig/proxy" << endl;
         if ( proxyFactory )
+        {
+          ProxyCache::instance().clear();	// results may differ, and no one must use the old factory
           assertProxyApi().deleteProxyFactory( proxyFactory );
+        }
 
         TmpUnsetEnv envguard[] __attribute__ ((__unused__)) = { "KDE_FULL_SESSION", "GNOME_DESKTOP_SESSION_ID", "DESKTOP_SESSION" };
         proxyFactory = assertProxyApi().createProxyFactory();
@@ -172,36 +279,22 @@ namespace zypp {
       return ( proxyApi () != nullptr );
     }
 
+    void ProxyInfoLibproxy::prefetch( const Url & url_r )
+    {
+      if ( !isAvailabe() )
+        return;
+
+      pxProxyFactoryType * factory = getProxyFactory();
+      if ( factory )
+        ProxyCache::instance().prefetch( factory, url_r );
+    }
+
     std::string ProxyInfoLibproxy::proxy(const Url & url_r) const
     {
       if (!_enabled)
         return "";
 
-      const url::ViewOption vopt =
-              url::ViewOption::WITH_SCHEME
-              + url::ViewOption::WITH_HOST
-              + url::ViewOption::WITH_PORT
-              + url::ViewOption::WITH_PATH_NAME;
-
-      auto &api = assertProxyApi ();
-
-      zypp::AutoDispose<char **> proxies(
-            api.getProxies(_factory, (char *)url_r.asString(vopt).c_str())
-            , api.freeProxies
-      );
-      if ( !proxies.value() )
-              return "";
-
-      /* cURL can only handle HTTP proxies, not SOCKS. And can only handle
-         one. So look through the list and find an appropriate one. */
-      std::optional<std::string> result;
-      for (int i = 0; proxies[i]; i++) {
-        if ( !result && !strncmp(proxies[i], "http://", 7) ) {
-          result = str::asString( proxies[i] );
-        }
-      }
-
-      return result.value_or( "" );
+      return ProxyCache::instance().get( _factory, url_r );
     }
 
     ProxyInfo::NoProxyIterator ProxyInfoLibproxy::noProxyBegin() const
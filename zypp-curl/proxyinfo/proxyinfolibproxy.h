@@ -45,10 +45,16 @@ namespace zypp {
 
       static bool isAvailabe();
 
+      /** Start evaluating the proxy for \a url_r on a worker thread.
+       * Results are cached per scheme, host and port for a while, so a
+       * later \ref proxy call for the same host does not need to wait.
+       */
+      static void prefetch( const Url & url_r );
+
       /**  */
       bool enabled() const override
       { return _enabled; }
-      /**  */
+      /** The (cached) libproxy result for \a url_r's scheme, host and port. */
       std::string proxy(const Url & url_r) const override;
       /**  */
       ProxyInfo::NoProxyList noProxy() const override
@@ -17,6 +17,9 @@ extern "C"
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <zypp-core/base/LogControl.h>
 #include <zypp-core/ExternalProgram.h>
 
@@ -100,4 +103,50 @@ namespace zypp::media {
     return true;
   }
 
+  CDTools::DriveStatus CDTools::driveStatus( const std::string & device_r )
+  {
+    int fd = ::open( device_r.c_str(), O_RDONLY|O_NONBLOCK|O_CLOEXEC );
+    if ( fd == -1 ) {
+      WAR << "Unable to open '" << device_r << "' (" << ::strerror( errno ) << ")" << std::endl;
+      return DriveStatus::Unknown;
+    }
+    int res = ::ioctl( fd, CDROM_DRIVE_STATUS, CDSL_CURRENT );
+    ::close( fd );
+    switch ( res ) {
+      case CDS_NO_DISC:         return DriveStatus::NoDisc;
+      case CDS_TRAY_OPEN:       return DriveStatus::TrayOpen;
+      case CDS_DRIVE_NOT_READY: return DriveStatus::NotReady;
+      case CDS_DISC_OK:         return DriveStatus::DiscOk;
+    }
+    return DriveStatus::Unknown;
+  }
+
+  std::vector<CDTools::DriveStatus> CDTools::probeDevices( const std::vector<std::string> & devices_r )
+  {
+    // Closing the tray may take a while until the drive has spun up
+    // and knows whether there is a disc.
+    const auto probe = []( const std::string & device_r ) {
+      closeTray( device_r );
+      DriveStatus ret = driveStatus( device_r );
+      for ( unsigned retry = 20; ret == DriveStatus::NotReady && retry; --retry ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 250 ) );
+        ret = driveStatus( device_r );
+      }
+      return ret;
+    };
+
+    std::vector<std::future<DriveStatus>> jobs;
+    jobs.reserve( devices_r.size() );
+    for ( const auto & device : devices_r )
+      jobs.push_back( std::async( std::launch::async, probe, std::cref( device ) ) );
+
+    std::vector<DriveStatus> ret;
+    ret.reserve( jobs.size() );
+    for ( unsigned i = 0; i < jobs.size(); ++i ) {
+      ret.push_back( jobs[i].get() );
+      DBG << "Probed " << devices_r[i] << ": " << int(ret.back()) << std::endl;
+    }
+    return ret;
+  }
+
 }
@@ -14,14 +14,37 @@
 #define ZYPP_MEDIA_CDTOOLS_H
 
 #include <string>
+#include <vector>
 
 namespace zypp::media {
 
   class CDTools
   {
   public:
+    /** What the drive reports about its medium (\c CDROM_DRIVE_STATUS). */
+    enum class DriveStatus
+    {
+      Unknown,	///< ioctl not supported or failed; just try it
+      NoDisc,
+      TrayOpen,
+      NotReady,
+      DiscOk
+    };
+
     static bool openTray( const std::string & device_r );
     static bool closeTray( const std::string & device_r );
+
+    static DriveStatus driveStatus( const std::string & device_r );
+
+    /** Whether a drive reporting \a status_r is worth a mount attempt. */
+    static bool mayHaveDisc( DriveStatus status_r )
+    { return status_r != DriveStatus::NoDisc && status_r != DriveStatus::TrayOpen; }
+
+    /** Close the trays of \a devices_r and wait until the drives are ready.
+     * The devices are probed in parallel, so slow drives spinning up do not
+     * add up. Returns the \ref DriveStatus of each device (same order).
+     */
+    static std::vector<DriveStatus> probeDevices( const std::vector<std::string> & devices_r );
   };
 
 }
@@ -23,8 +23,10 @@
 #include <zypp-media/ng/ProvideRes>
 #include <zypp-media/ng/ProvideSpec>
 #include <zypp-core/zyppng/base/private/base_p.h>
+#include <optional>
 #include <set>
 #include <variant>
+#include <vector>
 
 namespace zyppng {
 
@@ -167,6 +169,9 @@ namespace zyppng {
 
   /*!
    * Item attaching and verifying a medium
+   *
+   * For downloading schemes the media file is requested from all mirrors at once,
+   * the first mirror serving the expected medium wins and the other requests are cancelled.
    */
   class AttachMediaItem : public ProvideItem
   {
@@ -183,8 +188,11 @@ namespace zyppng {
     // ProvideItem interface
     void initialize () override;
 
-    using ProvideItem::finishReq;
+    ItemStats makeStats () override;
+    void informalMessage ( ProvideQueue &queue, ProvideRequestRef req, const ProvideMessage &msg  ) override;
+    void cacheMiss ( ProvideRequestRef req ) override;
     void finishReq (  ProvideQueue &queue, ProvideRequestRef finishedReq, const ProvideMessage &msg ) override;
+    void finishReq ( ProvideQueue *queue, ProvideRequestRef finishedReq, const std::exception_ptr excpt ) override;
     void cancelWithError( std::exception_ptr error ) override;
     void finishWithSuccess (AttachedMediaInfo_Ptr medium );
     expected<zypp::media::AuthData> authenticationRequired ( ProvideQueue &queue, ProvideRequestRef req, const zypp::Url &effectiveUrl, int64_t lastTimestamp, const std::map<std::string, std::string> &extraFields ) override;
@@ -192,6 +200,12 @@ namespace zyppng {
     void onMasterItemReady ( const zyppng::expected<AttachedMediaInfo *>& result );
 
   private:
+    bool isProbe ( const ProvideRequestRef &req ) const;
+    bool probePendingBefore ( unsigned mirrorIdx ) const;
+    void finishProbe ( ProvideQueue &queue, ProvideRequestRef probe, const ProvideMessage &msg );
+    void probeFailed ( ProvideRequestRef probe, std::exception_ptr error );
+    void cancelProbes ( std::exception_ptr error );
+
     Signal< void( const zyppng::expected<AttachedMediaInfo *> & )> _sigReady;
     bool _promiseCreated = false;
     connection _masterItemConn;
@@ -200,6 +214,10 @@ namespace zyppng {
     ProvideQueue::Config::WorkerType _workerType = ProvideQueue::Config::Invalid;
     ProvidePromiseWeakRef<Provide::MediaHandle> _promise;
     MediaDataVerifierRef _verifier;
+    std::vector<ProvideRequestRef> _probes;      //< Running media file requests, one per mirror
+    std::vector<ProvideRequestRef> _probeOrder;  //< All media file requests in the order of _mirrorList
+    std::exception_ptr _probeError;              //< Error of the last failed probe
+    std::optional<std::pair<unsigned, zypp::Url>> _relaxedMatch; //< First mirror (index and URL) without a media file, used if the medium is the only one and no earlier mirror has it
   };
 }
 
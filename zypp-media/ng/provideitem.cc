@@ -24,6 +24,106 @@ namespace zyppng {
 
   static constexpr std::string_view DEFAULT_MEDIA_VERIFIER("SuseMediaV1");
 
+  namespace {
+    /*!
+     * Turns the error message \a msg the worker sent for \a req into an exception.
+     */
+    std::exception_ptr errorFromMessage( const ProvideRequestRef &req, const ProvideMessage &msg )
+    {
+      std::exception_ptr errPtr;
+      const auto code = msg.code();
+      try {
+        const auto reqUrl = req->activeUrl().value();
+        const auto reason  = msg.value( ErrMsgFields::Reason ).asString();
+        switch ( code ) {
+          case ProvideMessage::Code::BadRequest:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException (zypp::str::Str() << "Bad request for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::PeerCertificateInvalid:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException(zypp::str::Str() << "PeerCertificateInvalid Error for URL: " << reqUrl << " " << reason) );
+            break;
+          case ProvideMessage::Code::ConnectionFailed:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException(zypp::str::Str() << "ConnectionFailed Error for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::ExpectedSizeExceeded: {
+
+            std::optional<int64_t> filesize;
+            const auto &hdrs = req->provideMessage ().headers ();
+            if ( hdrs.contains( ProvideMsgFields::ExpectedFilesize ) ) {
+              const auto &val = hdrs.value ( ProvideMsgFields::ExpectedFilesize );
+              if ( val.valid() )
+                filesize = val.asInt64();
+            }
+
+            if ( !filesize ) {
+              errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "ExceededExpectedSize Error for URL: " << reqUrl << " " << reason ) );
+            } else {
+              errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaFileSizeExceededException(reqUrl, *filesize ) );
+            }
+            break;
+          }
+          case ProvideMessage::Code::Cancelled:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Request was cancelled: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::InvalidChecksum:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "InvalidChecksum Error for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::Timeout:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaTimeoutException(reqUrl) );
+            break;
+          case ProvideMessage::Code::NotFound:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaFileNotFoundException(reqUrl, "") );
+            break;
+          case ProvideMessage::Code::Forbidden:
+          case ProvideMessage::Code::Unauthorized: {
+
+            const auto &hintVal = msg.value( "authHint"sv );
+            std::string hint;
+            if ( hintVal.valid() && hintVal.isString() ) {
+              hint = hintVal.asString();
+            }
+
+            //@TODO retry here with timestamp from cred store check
+            // we let the request fail after it checked the store
+
+            errPtr = ZYPP_EXCPT_PTR ( zypp::media::MediaUnauthorizedException(
+              reqUrl, reason, "", hint
+              ));
+            break;
+
+          }
+          case ProvideMessage::Code::MountFailed:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "MountFailed Error for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::Jammed:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaJammedException() );
+            break;
+          case ProvideMessage::Code::MediaChangeSkip:
+            errPtr = ZYPP_EXCPT_PTR( zypp::SkipRequestException ( zypp::str::Str() << "User-requested skipping for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::MediaChangeAbort:
+            errPtr = ZYPP_EXCPT_PTR( zypp::AbortRequestException( zypp::str::Str() <<"Aborting requested by user for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::InternalError:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "WorkerSpecific Error for URL: " << reqUrl << " " << reason ) );
+            break;
+          case ProvideMessage::Code::NotAFile:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaNotAFileException(reqUrl, "") );
+            break;
+          case ProvideMessage::Code::MediumNotDesired:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaNotDesiredException(reqUrl) );
+            break;
+          default:
+            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Unknown Error for URL: " << reqUrl << " " << reason ) );
+            break;
+        }
+      } catch (...) {
+        errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Invalid error message received for URL: " << *req->activeUrl() << " code: " << code ) );
+      }
+      return errPtr;
+    }
+  }
+
   expected<ProvideRequestRef> ProvideRequest::create(ProvideItem &owner, const std::vector<zypp::Url> &urls, const std::string &id, ProvideMediaSpec &spec )
   {
     if ( urls.empty() )
@@ -279,96 +379,7 @@ namespace zyppng {
       // remove the old request
       _runningReq.reset();
 
-      std::exception_ptr errPtr;
-      try {
-        const auto reqUrl = finishedReq->activeUrl().value();
-        const auto reason  = msg.value( ErrMsgFields::Reason ).asString();
-        switch ( code ) {
-          case ProvideMessage::Code::BadRequest:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException (zypp::str::Str() << "Bad request for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::PeerCertificateInvalid:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException(zypp::str::Str() << "PeerCertificateInvalid Error for URL: " << reqUrl << " " << reason) );
-            break;
-          case ProvideMessage::Code::ConnectionFailed:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException(zypp::str::Str() << "ConnectionFailed Error for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::ExpectedSizeExceeded: {
-
-            std::optional<int64_t> filesize;
-            const auto &hdrs = finishedReq->provideMessage ().headers ();
-            if ( hdrs.contains( ProvideMsgFields::ExpectedFilesize ) ) {
-              const auto &val = hdrs.value ( ProvideMsgFields::ExpectedFilesize );
-              if ( val.valid() )
-                filesize = val.asInt64();
-            }
-
-            if ( !filesize ) {
-              errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "ExceededExpectedSize Error for URL: " << reqUrl << " " << reason ) );
-            } else {
-              errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaFileSizeExceededException(reqUrl, *filesize ) );
-            }
-            break;
-          }
-          case ProvideMessage::Code::Cancelled:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Request was cancelled: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::InvalidChecksum:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "InvalidChecksum Error for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::Timeout:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaTimeoutException(reqUrl) );
-            break;
-          case ProvideMessage::Code::NotFound:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaFileNotFoundException(reqUrl, "") );
-            break;
-          case ProvideMessage::Code::Forbidden:
-          case ProvideMessage::Code::Unauthorized: {
-
-            const auto &hintVal = msg.value( "authHint"sv );
-            std::string hint;
-            if ( hintVal.valid() && hintVal.isString() ) {
-              hint = hintVal.asString();
-            }
-
-            //@TODO retry here with timestamp from cred store check
-            // we let the request fail after it checked the store
-
-            errPtr = ZYPP_EXCPT_PTR ( zypp::media::MediaUnauthorizedException(
-              reqUrl, reason, "", hint
-              ));
-            break;
-
-          }
-          case ProvideMessage::Code::MountFailed:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "MountFailed Error for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::Jammed:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaJammedException() );
-            break;
-          case ProvideMessage::Code::MediaChangeSkip:
-            errPtr = ZYPP_EXCPT_PTR( zypp::SkipRequestException ( zypp::str::Str() << "User-requested skipping for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::MediaChangeAbort:
-            errPtr = ZYPP_EXCPT_PTR( zypp::AbortRequestException( zypp::str::Str() <<"Aborting requested by user for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::InternalError:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "WorkerSpecific Error for URL: " << reqUrl << " " << reason ) );
-            break;
-          case ProvideMessage::Code::NotAFile:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaNotAFileException(reqUrl, "") );
-            break;
-          case ProvideMessage::Code::MediumNotDesired:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaNotDesiredException(reqUrl) );
-            break;
-          default:
-            errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Unknown Error for URL: " << reqUrl << " " << reason ) );
-            break;
-        }
-      } catch (...) {
-        errPtr = ZYPP_EXCPT_PTR( zypp::media::MediaException( zypp::str::Str() << "Invalid error message received for URL: " << *finishedReq->activeUrl() << " code: " << code ) );
-      }
-
+      const auto errPtr = errorFromMessage( finishedReq, msg );
       if ( log ) log->requestFailed( *this, msg.requestId(), errPtr );
       // finish the request
       cancelWithError( errPtr );
@@ -399,7 +410,8 @@ namespace zyppng {
   expected<zypp::media::AuthData> ProvideItem::authenticationRequired ( ProvideQueue &queue, ProvideRequestRef req, const zypp::Url &effectiveUrl, int64_t lastTimestamp, const std::map<std::string, std::string> &extraFields )
   {
 
-    if ( req != _runningReq ) {
+    // match by owner, items may run more requests than just _runningReq
+    if ( req->owner() != this ) {
       WAR << "Received authenticationRequired for unknown request, rejecting" << std::endl;
       return expected<zypp::media::AuthData>::error( ZYPP_EXCPT_PTR( zypp::media::MediaException("Unknown request in authenticationRequired, this is a bug.") ) );
     }
@@ -959,14 +971,6 @@ namespace zyppng {
 
         _verifier = smvDataLocal;
 
-        std::vector<zypp::Url> urls;
-        urls.reserve( _mirrorList.size () );
-
-        for ( zypp::Url url : _mirrorList ) {
-          url.appendPathName ( ( zypp::str::Format("/media.%d/media") % _initialSpec.medianr() ).asString() );
-          urls.push_back(url);
-        }
-
         // for downloading schemes we ask for the /media.x/media file and check the data manually
         ProvideFileSpec spec;
         spec.customHeaders() = _initialSpec.customHeaders();
@@ -974,14 +978,26 @@ namespace zyppng {
         // disable metalink
         spec.customHeaders().set( std::string(NETWORK_METALINK_ENABLED), false );
 
-        auto req = ProvideRequest::create( *this, urls, spec );
-        if ( !req ) {
-          cancelWithError( req.error() );
-          return;
+        // ask all mirrors at once, the first one serving the right medium is used
+        _probes.reserve( _mirrorList.size() );
+        for ( zypp::Url url : _mirrorList ) {
+          url.appendPathName ( ( zypp::str::Format("/media.%d/media") % _initialSpec.medianr() ).asString() );
+
+          auto req = ProvideRequest::create( *this, { url }, spec );
+          if ( !req ) {
+            cancelWithError( req.error() );
+            return;
+          }
+          _probes.push_back( *req );
         }
-        if ( !enqueueRequest( *req ) ) {
-          cancelWithError( ZYPP_EXCPT_PTR(zypp::media::MediaException("Failed to queue request")) );
-          return;
+        _probeOrder = _probes;
+
+        MIL << "Verifying medium " << _initialSpec.medianr() << " on " << _probes.size() << " mirrors" << std::endl;
+        for ( const auto &probe : _probes ) {
+          if ( !provider().queueRequest( probe ) ) {
+            cancelWithError( ZYPP_EXCPT_PTR(zypp::media::MediaException("Failed to queue request")) );
+            return;
+          }
         }
         updateState ( Downloading );
         break;
@@ -1055,6 +1071,8 @@ namespace zyppng {
     // tell children
     _sigReady.emit( expected<AttachedMediaInfo *>::error(error) );
 
+    cancelProbes( error );
+
     if ( _runningReq ) {
       // we might get deleted when calling dequeueRequest
       auto weakThis = weak_from_this ();
@@ -1114,63 +1132,18 @@ namespace zyppng {
 
   void AttachMediaItem::finishReq ( ProvideQueue &queue, ProvideRequestRef finishedReq, const ProvideMessage &msg )
   {
-    if ( finishedReq != _runningReq ) {
-      WAR << "Received event for unknown request, ignoring" << std::endl;
-      return;
-    }
-
     if( _workerType == ProvideQueue::Config::Downloading ) {
-      // success
-      if ( msg.code() == ProvideMessage::Code::ProvideFinished ) {
-
-        updateState(Finalizing);
-
-        zypp::Url baseUrl = *finishedReq->activeUrl();
-        // remove /media.n/media
-        baseUrl.setPathName( zypp::Pathname(baseUrl.getPathName()).dirname().dirname() );
-
-        // we got the file, lets parse it
-        auto smvDataRemote = MediaDataVerifier::createVerifier("SuseMediaV1");
-        if ( !smvDataRemote ) {
-          return cancelWithError( ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, no verifier instance was returned.")) );
-        }
-
-        if ( !smvDataRemote->load( msg.value( ProvideFinishedMsgFields::LocalFilename ).asString() ) ) {
-          return cancelWithError( ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, unable to load remote verify data.")) );
-        }
-
-        // check if we got a valid media file
-        if ( !smvDataRemote->valid () ) {
-          return cancelWithError( ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, unable to load local verify data.")) );
-        }
-
-        // check if the received file matches with the one we have in the spec
-        if (! _verifier->matches( smvDataRemote ) ) {
-          DBG << "expect: " << _verifier      << " medium " << _initialSpec.medianr() << std::endl;
-          DBG << "remote: " << smvDataRemote  << std::endl;
-          return cancelWithError( ZYPP_EXCPT_PTR( zypp::media::MediaNotDesiredException( *finishedReq->activeUrl() ) ) );
-        }
-
-        // all good, register the medium and tell all child items
-        _runningReq.reset();
-        return finishWithSuccess( provider().addMedium( zypp::make_intrusive<AttachedMediaInfo>( provider().nextMediaId(), _workerType, baseUrl, _initialSpec) ) );
-
-      } else if ( msg.code() == ProvideMessage::Code::NotFound ) {
-
-        // simple downloading attachment we need to check the media file contents
-        // in case of a error we might tolerate a file not found error in certain situations
-        if ( _verifier->totalMedia () == 1 ) {
-          // relaxed , tolerate a vanished media file
-          _runningReq.reset();
-
-          return finishWithSuccess( provider().addMedium( zypp::make_intrusive<AttachedMediaInfo>( provider().nextMediaId(), _workerType, _mirrorList.front(), _initialSpec ) ) );
-        } else {
-          return ProvideItem::finishReq ( queue, finishedReq, msg );
-        }
-      } else {
-        return ProvideItem::finishReq ( queue, finishedReq, msg );
+      if ( !isProbe( finishedReq ) ) {
+        WAR << "Received event for unknown request, ignoring" << std::endl;
+        return;
       }
+      return finishProbe( queue, finishedReq, msg );
     } else {
+      if ( finishedReq != _runningReq ) {
+        WAR << "Received event for unknown request, ignoring" << std::endl;
+        return;
+      }
+
       // real device attach
       if ( msg.code() == ProvideMessage::Code::AttachFinished ) {
 
@@ -1195,6 +1168,178 @@ namespace zyppng {
     return ProvideItem::finishReq ( queue, finishedReq, msg );
   }
 
+  void AttachMediaItem::finishReq ( ProvideQueue *queue, ProvideRequestRef finishedReq, const std::exception_ptr excpt )
+  {
+    if ( isProbe( finishedReq ) ) {
+      auto log = provider().log();
+      if ( log ) log->requestFailed( *this, finishedReq->provideMessage().requestId(), excpt );
+      return probeFailed( finishedReq, excpt );
+    }
+
+    // probes we cancelled ourselves report back here as well
+    if ( _workerType == ProvideQueue::Config::Downloading )
+      return;
+
+    ProvideItem::finishReq( queue, finishedReq, excpt );
+  }
+
+  ProvideItem::ItemStats AttachMediaItem::makeStats ()
+  {
+    auto stats = ProvideItem::makeStats();
+    stats._runningRequests += _probes.size();
+    return stats;
+  }
+
+  void AttachMediaItem::informalMessage ( ProvideQueue &queue, ProvideRequestRef req, const ProvideMessage &msg )
+  {
+    if ( isProbe( req ) ) {
+      if ( msg.code() == ProvideMessage::Code::ProvideStarted )
+        MIL << "Request: "<< req->url() << " was started" << std::endl;
+      return;
+    }
+    ProvideItem::informalMessage( queue, req, msg );
+  }
+
+  void AttachMediaItem::cacheMiss ( ProvideRequestRef req )
+  {
+    if ( isProbe( req ) ) {
+      MIL << "Request: "<< req->url() << " CACHE MISS, request will be restarted by queue." << std::endl;
+      return;
+    }
+    ProvideItem::cacheMiss( req );
+  }
+
+  bool AttachMediaItem::isProbe ( const ProvideRequestRef &req ) const
+  {
+    return std::find( _probes.begin(), _probes.end(), req ) != _probes.end();
+  }
+
+  bool AttachMediaItem::probePendingBefore ( unsigned mirrorIdx ) const
+  {
+    for ( unsigned i = 0; i < mirrorIdx && i < _probeOrder.size(); ++i ) {
+      if ( isProbe( _probeOrder[i] ) )
+        return true;
+    }
+    return false;
+  }
+
+  void AttachMediaItem::finishProbe ( ProvideQueue &, ProvideRequestRef probe, const ProvideMessage &msg )
+  {
+    auto log = provider().log();
+    const auto code = msg.code();
+
+    if ( code == ProvideMessage::Code::ProvideFinished ) {
+
+      zypp::Url baseUrl = *probe->activeUrl();
+      // remove /media.n/media
+      baseUrl.setPathName( zypp::Pathname(baseUrl.getPathName()).dirname().dirname() );
+
+      // we got the file, lets parse it
+      auto smvDataRemote = MediaDataVerifier::createVerifier("SuseMediaV1");
+      if ( !smvDataRemote ) {
+        return probeFailed( probe, ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, no verifier instance was returned.")) );
+      }
+
+      if ( !smvDataRemote->load( msg.value( ProvideFinishedMsgFields::LocalFilename ).asString() ) ) {
+        return probeFailed( probe, ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, unable to load remote verify data.")) );
+      }
+
+      // check if we got a valid media file
+      if ( !smvDataRemote->valid () ) {
+        return probeFailed( probe, ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, remote verify data is invalid.")) );
+      }
+
+      // check if the received file matches with the one we have in the spec
+      if (! _verifier->matches( smvDataRemote ) ) {
+        DBG << "expect: " << _verifier      << " medium " << _initialSpec.medianr() << std::endl;
+        DBG << "remote: " << smvDataRemote  << std::endl;
+        return probeFailed( probe, ZYPP_EXCPT_PTR( zypp::media::MediaNotDesiredException( *probe->activeUrl() ) ) );
+      }
+
+      // all good, stop asking the other mirrors, register the medium and tell all child items
+      MIL << "Medium " << _initialSpec.medianr() << " found on " << baseUrl << std::endl;
+      _probes.erase( std::find( _probes.begin(), _probes.end(), probe ) );
+      cancelProbes( ZYPP_EXCPT_PTR( zypp::media::MediaRequestCancelledException("Medium was found on a different mirror") ) );
+      return finishWithSuccess( provider().addMedium( zypp::make_intrusive<AttachedMediaInfo>( provider().nextMediaId(), _workerType, baseUrl, _initialSpec) ) );
+
+    } else if ( code == ProvideMessage::Code::NotFound && _verifier->totalMedia () == 1 ) {
+
+      // relaxed, tolerate a vanished media file unless an earlier mirror has a matching one
+      const unsigned mirrorIdx = std::find( _probeOrder.begin(), _probeOrder.end(), probe ) - _probeOrder.begin();
+      if ( !_relaxedMatch || mirrorIdx < _relaxedMatch->first ) {
+        zypp::Url baseUrl = *probe->activeUrl();
+        baseUrl.setPathName( zypp::Pathname(baseUrl.getPathName()).dirname().dirname() );
+        _relaxedMatch = std::make_pair( mirrorIdx, baseUrl );
+      }
+      return probeFailed( probe, std::exception_ptr() );
+
+    } else if ( code == ProvideMessage::Code::Redirect ) {
+
+      try {
+        zypp::Url newUrl( msg.value( RedirectMsgFields::NewUrl ).asString() );
+        if ( !safeRedirectTo( probe, newUrl ) )
+          return probeFailed( probe, ZYPP_EXCPT_PTR ( zypp::media::MediaException("Redirect Loop")) );
+
+        MIL << "Request redirected to: " << newUrl << std::endl;
+        if ( log ) log->requestRedirect( *this, msg.requestId(), newUrl );
+
+        probe->setUrl( newUrl );
+        if ( !provider().queueRequest( probe ) )
+          return probeFailed( probe, ZYPP_EXCPT_PTR(zypp::media::MediaException("Failed to queue request")) );
+      } catch ( ... ) {
+        return probeFailed( probe, std::current_exception() );
+      }
+      return;
+
+    } else if ( code >= ProvideMessage::Code::FirstClientErrCode && code <= ProvideMessage::Code::LastSrvErrCode ) {
+
+      const auto errPtr = errorFromMessage( probe, msg );
+      if ( log ) log->requestFailed( *this, msg.requestId(), errPtr );
+      return probeFailed( probe, errPtr );
+    }
+
+    probeFailed( probe, ZYPP_EXCPT_PTR (zypp::media::MediaException("Unhandled message received for AttachMediaItem")) );
+  }
+
+  void AttachMediaItem::probeFailed ( ProvideRequestRef probe, std::exception_ptr error )
+  {
+    _probes.erase( std::find( _probes.begin(), _probes.end(), probe ) );
+    if ( error )
+      _probeError = error;
+
+    // like trying the mirrors one after another: once all earlier mirrors failed,
+    // the first one without a media file is used, the later ones are not waited for
+    if ( _relaxedMatch && !probePendingBefore( _relaxedMatch->first ) ) {
+      MIL << "Medium " << _initialSpec.medianr() << " not verified, using " << _relaxedMatch->second << std::endl;
+      cancelProbes( ZYPP_EXCPT_PTR( zypp::media::MediaRequestCancelledException("Medium was accepted on a different mirror") ) );
+      return finishWithSuccess( provider().addMedium( zypp::make_intrusive<AttachedMediaInfo>( provider().nextMediaId(), _workerType, _relaxedMatch->second, _initialSpec ) ) );
+    }
+
+    if ( !_probes.empty() ) {
+      MIL << "Media probe on " << probe->url() << " failed, waiting for " << _probes.size() << " more mirrors" << std::endl;
+      return;
+    }
+
+    // no mirror had the medium
+    if ( !_probeError )
+      _probeError = ZYPP_EXCPT_PTR( zypp::media::MediaException("Unable to verify the medium, no mirror left.") );
+    cancelWithError( _probeError );
+  }
+
+  void AttachMediaItem::cancelProbes ( std::exception_ptr error )
+  {
+    _probeOrder.clear();
+    if ( _probes.empty() )
+      return;
+
+    // dequeueRequest calls finishReq for each probe, forget them first so they are ignored there
+    auto probes = std::move( _probes );
+    _probes.clear();
+
+    for ( const auto &probe : probes )
+      provider().dequeueRequest( probe, error );
+  }
+
   expected<zypp::media::AuthData> AttachMediaItem::authenticationRequired ( ProvideQueue &queue, ProvideRequestRef req, const zypp::Url &effectiveUrl, int64_t lastTimestamp, const std::map<std::string, std::string> &extraFields )
   {
     zypp::Url baseUrl = effectiveUrl;
@@ -203,6 +203,19 @@ std::ostream & TableRow::dumpDetails( std::ostream & stream, const Table & paren
   return stream;
 }
 
+unsigned TableRow::cachedWidth( unsigned c, bool translated_r ) const
+{
+  const container & cols { translated_r ? _translatedColumns : _columns };
+  unsigned idx = translated_r ? _columns.size() + c : c;
+  if ( _widths.size() != _columns.size() + _translatedColumns.size() )
+    _widths.assign( _columns.size() + _translatedColumns.size(), 0 );	// rows grow while being built
+
+  unsigned & ret { _widths[idx] };
+  if ( ! ret )
+    ret = mbs_width( cols[c] ) + 1;
+  return ret - 1;
+}
+
 std::ostream & TableRow::dumpTo( std::ostream & stream, const Table & parent ) const
 {
   const char * vline = parent._style == none ? "" : lines[parent._style][0];
@@ -247,7 +260,7 @@ std::ostream & TableRow::dumpTo( std::ostream & stream, const Table & parent ) c
       seen_first = true;
 
     // stream.width (widths[c]); // that does not work with multibyte chars
-    ssize = mbs_width( s );
+    ssize = columnWidthNoTr( c );
     if ( ssize > parent._max_width[c] )
     {
       unsigned cutby = parent._max_width[c] - 2;
@@ -368,11 +381,10 @@ void Table::updateColWidths( const TableRow & tr ) const
     _max_col = _max_width.size()-1;
   }
 
-  unsigned c = 0;
-  for ( const auto & col : columns )
+  for ( unsigned c = 0; c < columns.size(); ++c )
   {
-    unsigned &max = _max_width[c++];
-    unsigned cur = mbs_width( col );
+    unsigned &max = _max_width[c];
+    unsigned cur = tr.columnWidth( c );
 
     if ( max < cur )
       max = cur;
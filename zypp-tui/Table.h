@@ -230,13 +230,24 @@ public:
   { return _translateColumns ? _translatedColumns : _columns; }
 
   container & columns()
-  { return _translateColumns ? _translatedColumns : _columns; }
+  { _widths.clear(); return _translateColumns ? _translatedColumns : _columns; }
 
   const container & columnsNoTr() const
   { return _columns; }
 
   container & columnsNoTr()
-  { return _columns; }
+  { _widths.clear(); return _columns; }
+
+  /** Screen width of \ref columns entry \a c (computed once). */
+  unsigned columnWidth( unsigned c ) const
+  { return cachedWidth( c, _translateColumns ); }
+
+  /** Screen width of \ref columnsNoTr entry \a c (computed once). */
+  unsigned columnWidthNoTr( unsigned c ) const
+  { return cachedWidth( c, false ); }
+
+private:
+  unsigned cachedWidth( unsigned c, bool translated_r ) const;
 
 protected:
   bool      _translateColumns = false;
@@ -244,6 +255,8 @@ private:
   container _columns;
   container _translatedColumns;
   container _details;
+  /** Cached \ref mbs_width of _columns followed by _translatedColumns (+1, 0 if not yet computed). */
+  mutable std::vector<unsigned> _widths;
   ColorContext _ctxt;
   boost::any _userData;	///< user defined sort index, e.g. if string values don't work due to coloring
 };
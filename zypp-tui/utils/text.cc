@@ -8,11 +8,88 @@
 ----------------------------------------------------------------------*/
 
 #include <cstring>
+#include <cstdint>
+#include <array>
+#include <atomic>
+#include <langinfo.h>
 #include <boost/utility/string_ref.hpp>
 #include "text.h"
 
 namespace ztui {
 
+namespace mbs
+{
+  namespace
+  {
+    /** UTF-8 sequence length indexed by lead byte (\c 0: not a valid lead byte). */
+    constexpr std::array<unsigned char,256> utf8SeqLen = []() {
+      std::array<unsigned char,256> ret {};
+      for ( unsigned i = 0x00; i <= 0x7F; ++i ) ret[i] = 1;
+      for ( unsigned i = 0xC2; i <= 0xDF; ++i ) ret[i] = 2;
+      for ( unsigned i = 0xE0; i <= 0xEF; ++i ) ret[i] = 3;
+      for ( unsigned i = 0xF0; i <= 0xF4; ++i ) ret[i] = 4;
+      return ret;
+    }();
+
+    /** Payload bits of the lead byte indexed by sequence length. */
+    constexpr unsigned char utf8LeadMask[] = { 0x00, 0x7F, 0x1F, 0x0F, 0x07 };
+  } // namespace
+
+  bool localeIsUtf8()
+  {
+    static const bool ret = ( ::strcmp( ::nl_langinfo( CODESET ), "UTF-8" ) == 0 );
+    return ret;
+  }
+
+  size_t decodeUtf8( wchar_t & wc_r, const char * pos_r, size_t len_r )
+  {
+    const unsigned char * p = reinterpret_cast<const unsigned char *>( pos_r );
+    size_t len = utf8SeqLen[*p];
+    if ( len == 0 || len > len_r )
+      return 0;
+
+    // The valid range of the 2nd byte depends on the lead byte:
+    // no overlong forms, no surrogates, nothing beyond U+10FFFF.
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    switch ( *p )
+    {
+      case 0xE0: lo = 0xA0; break;
+      case 0xED: hi = 0x9F; break;
+      case 0xF0: lo = 0x90; break;
+      case 0xF4: hi = 0x8F; break;
+    }
+    if ( len > 1 && ( p[1] < lo || p[1] > hi ) )
+      return 0;
+
+    uint32_t wc = *p & utf8LeadMask[len];
+    for ( size_t i = 1; i < len; ++i )
+    {
+      if ( ( p[i] & 0xC0 ) != 0x80 )
+        return 0;
+      wc = ( wc << 6 ) | ( p[i] & 0x3F );
+    }
+    wc_r = wchar_t(wc);
+    return len;
+  }
+
+  int charWidth( wchar_t wc_r )
+  {
+    if ( wc_r < 0 || wc_r > 0xFFFF )
+      return ::wcwidth( wc_r );
+
+    // ::wcwidth is in [-1,2]; we store it +2 so 0 denotes 'not yet computed'.
+    static std::atomic<signed char> _table[0x10000];
+    signed char ret = _table[wc_r].load( std::memory_order_relaxed );
+    if ( ! ret )
+    {
+      ret = ::wcwidth( wc_r ) + 2;
+      _table[wc_r].store( ret, std::memory_order_relaxed );
+    }
+    return ret - 2;
+  }
+} // namespace mbs
+
 std::string mbs_substr_by_width( boost::string_ref text_r, std::string::size_type colpos_r, std::string::size_type collen_r )
 {
   std::string ret;
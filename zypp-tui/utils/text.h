@@ -72,6 +72,21 @@ namespace mbs
     char _cont;
   };
 
+  /** Whether the current \c LC_CTYPE uses UTF-8.
+   * Evaluated once, so the locale should be set up before the first use.
+   */
+  bool localeIsUtf8();
+
+  /** Table driven decoding of the UTF-8 sequence at \a pos_r (at most \a len_r bytes).
+   * Overlong forms, surrogates and codepoints beyond \c U+10FFFF are rejected,
+   * so in a UTF-8 locale the result is the same \c ::mbrtowc would compute.
+   * \return The number of bytes consumed or \c 0 if the sequence is invalid or truncated.
+   */
+  size_t decodeUtf8( wchar_t & wc_r, const char * pos_r, size_t len_r );
+
+  /** \c ::wcwidth of \a wc_r; BMP results are remembered in a lookup table. */
+  int charWidth( wchar_t wc_r );
+
   ///////////////////////////////////////////////////////////////////
   /// \class MbsIterator
   /// \brief Iterate chars and ANSI SGR in a multi-byte character string
@@ -106,9 +121,11 @@ namespace mbs
       {
         if ( _wc < L' ' )
           _cols = 0;	// CTRLs
+        else if ( _wc < L'\177' )
+          _cols = 1;	// printable ASCII
         else
         {
-          _cols = ::wcwidth( _wc );
+          _cols = charWidth( _wc );
           if ( _cols == size_t(-1) )
             _cols = 1;	// -1 due to LC_CTYPE?
         }
@@ -137,7 +154,19 @@ namespace mbs
           return *this;
         }
 
-        _tread = ::mbrtowc( &_wc, _tpos, _trest, &_mbstate );
+        if ( (unsigned char)*_tpos < 0x80 )	// ASCII is the same in all locales we support
+        {
+          _wc = (unsigned char)*_tpos;
+          _tread = ( _wc == L'\0' ? 0 : 1 );
+        }
+        else if ( localeIsUtf8() )
+        {
+          _tread = decodeUtf8( _wc, _tpos, _trest );
+          if ( _tread == 0 )
+            _tread = (size_t)-1;	// handled like a ::mbrtowc error below
+        }
+        else
+          _tread = ::mbrtowc( &_wc, _tpos, _trest, &_mbstate );
 
         _cols = size_t(-1);
 
@@ -640,7 +669,20 @@ inline void mbs_write_wrapped( std::ostream & out, const zypp::str::Str & text_r
 /** Returns the column width of a multi-byte character string \a text_r */
 inline size_t mbs_width( boost::string_ref text_r )
 {
+  // Fast path for plain ASCII (no SGR): each printable char and
+  // each WS (but '\n') occupies one column.
   size_t ret = 0;
+  for ( unsigned char ch : text_r )
+  {
+    if ( ch >= 0x80 || ch == '\0' || ch == '\033' )
+    { ret = size_t(-1); break; }	// UTF-8, NUL or SGR: take the long way
+    if ( ch >= ' ' || ( ch != '\n' && ::iswspace( ch ) ) )
+      ++ret;
+  }
+  if ( ret != size_t(-1) )
+    return ret;
+
+  ret = 0;
   for( mbs::MbsIterator it( text_r ); ! it.atEnd(); ++it )
     ret += it.columns();
   return ret;
@@ -13,6 +13,7 @@
 #include <set>
 
 #include <zypp/Changelog.h>
+#include <zypp/base/String.h>
 
 using std::endl;
 
@@ -26,6 +27,45 @@ namespace zypp
     return out;
   }
 
+  ///////////////////////////////////////////////////////////////////
+  // class ChangelogView
+  ///////////////////////////////////////////////////////////////////
+
+  ChangelogView::Source::~Source()
+  {}
+
+  bool ChangelogView::stopsAt( unsigned idx_r ) const
+  {
+    if ( ! _source || idx_r >= _source->size() )
+      return false;	// end anyway
+
+    if ( _stopDate && _source->date( idx_r ) <= _stopDate )
+      return true;
+
+    if ( _stopEdition != Edition::noedition )
+    {
+      // "Name <mail> - 1.2-3"
+      std::string_view author { _source->author( idx_r ) };
+      std::string_view::size_type pos = author.rfind( " - " );
+      if ( pos != std::string_view::npos )
+      {
+        std::string version { str::trim( std::string( author.substr( pos+3 ) ) ) };
+        if ( ! version.empty() && version.find( ' ' ) == std::string::npos
+          && Edition::match( Edition( version ), _stopEdition ) <= 0 )
+          return true;
+      }
+    }
+    return false;
+  }
+
+  Changelog ChangelogView::asChangelog() const
+  {
+    Changelog ret;
+    for ( const_iterator it = begin(); it != end(); ++it )
+      ret.push_back( *it );
+    return ret;
+  }
+
 
   /////////////////////////////////////////////////////////////////
 } // namespace zypp
@@ -13,11 +13,15 @@
 #define ZYPP_CHANGELOG_H
 
 #include <string>
+#include <string_view>
 #include <list>
+#include <memory>
+#include <iterator>
 #include <utility>
 
 #include <zypp/Globals.h>
 #include <zypp/Date.h>
+#include <zypp/Edition.h>
 
 ///////////////////////////////////////////////////////////////////
 namespace zypp
@@ -57,6 +61,133 @@ namespace zypp
   /** \relates ChangelogEntry */
   std::ostream & operator<<( std::ostream & out, const ChangelogEntry & obj ) ZYPP_API;
 
+  ///////////////////////////////////////////////////////////////////
+  /// \class ChangelogView
+  /// \brief Changelog entries decoded on demand.
+  ///
+  /// Unlike \ref Changelog the entries are not copied in advance, but
+  /// created while iterating, straight from the underlying data (e.g. the
+  /// rpm header, which is kept alive by the view). Iteration may stop
+  /// at a date or version:
+  /// \code
+  ///   for ( const ChangelogEntry & entry : pkg->changelogView().stopAtVersion( installed->edition() ) )
+  ///     std::cout << entry;
+  /// \endcode
+  /// Copies of a view share the data. Distinct views share nothing, so
+  /// the changelogs of many packages may be processed in parallel.
+  ///////////////////////////////////////////////////////////////////
+  class ZYPP_API ChangelogView
+  {
+  public:
+    /** Random access to the raw entries (newest first). */
+    struct Source
+    {
+      virtual ~Source();
+      virtual unsigned size() const = 0;
+      virtual Date date( unsigned idx_r ) const = 0;
+      virtual std::string_view author( unsigned idx_r ) const = 0;
+      virtual std::string_view text( unsigned idx_r ) const = 0;
+    };
+
+    class const_iterator;
+
+  public:
+    /** Default ctor: empty changelog */
+    ChangelogView()
+    {}
+
+    explicit ChangelogView( std::shared_ptr<const Source> source_r )
+    : _source( std::move(source_r) )
+    {}
+
+  public:
+    /** View stopping at the first entry not newer than \a date_r. */
+    ChangelogView stopAtDate( Date date_r ) const
+    { ChangelogView ret( *this ); ret._stopDate = date_r; return ret; }
+
+    /** View stopping at the first entry for version \a edition_r or older.
+     * The entries version is taken from the end of the author line
+     * (<tt>"Name <mail> - 1.2-3"</tt>). Entries without version never stop.
+     */
+    ChangelogView stopAtVersion( Edition edition_r ) const
+    { ChangelogView ret( *this ); ret._stopEdition = std::move(edition_r); return ret; }
+
+  public:
+    bool empty() const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    /** Decode the entries into a \ref Changelog. */
+    Changelog asChangelog() const;
+
+  private:
+    /** Whether iteration stops at entry \a idx_r. */
+    bool stopsAt( unsigned idx_r ) const;
+
+  private:
+    std::shared_ptr<const Source> _source;
+    Date _stopDate;
+    Edition _stopEdition;
+  };
+
+  ///////////////////////////////////////////////////////////////////
+  /// \class ChangelogView::const_iterator
+  /// \brief Input iterator creating the \ref ChangelogEntry on dereference.
+  ///
+  /// The iterator keeps a copy of its view (i.e. the data and the stop
+  /// criteria), so it stays valid if the view it was taken from is gone.
+  ///////////////////////////////////////////////////////////////////
+  class ZYPP_API ChangelogView::const_iterator
+  {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type        = ChangelogEntry;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = ChangelogEntry;
+
+    const_iterator()
+    {}
+
+    ChangelogEntry operator*() const
+    { return ChangelogEntry( date(), std::string( author() ), std::string( text() ) ); }
+
+    /** The entries date without decoding the entry. */
+    Date date() const
+    { return _view._source->date( _idx ); }
+    /** The entries author line without decoding the entry. */
+    std::string_view author() const
+    { return _view._source->author( _idx ); }
+    /** The entries text without decoding the entry. */
+    std::string_view text() const
+    { return _view._source->text( _idx ); }
+
+    const_iterator & operator++()
+    { if ( _view.stopsAt( ++_idx ) ) _idx = _view._source->size(); return *this; }
+
+    bool operator==( const const_iterator & rhs ) const
+    { return _idx == rhs._idx; }
+    bool operator!=( const const_iterator & rhs ) const
+    { return _idx != rhs._idx; }
+
+  private:
+    friend class ChangelogView;
+    const_iterator( ChangelogView view_r, unsigned idx_r )
+    : _view( std::move(view_r) ), _idx( idx_r )
+    {}
+    ChangelogView _view;
+    unsigned _idx = 0;
+  };
+
+  inline bool ChangelogView::empty() const
+  { return begin() == end(); }
+
+  inline ChangelogView::const_iterator ChangelogView::begin() const
+  { return stopsAt( 0 ) ? end() : const_iterator( *this, 0 ); }
+
+  inline ChangelogView::const_iterator ChangelogView::end() const
+  { return const_iterator( *this, _source ? _source->size() : 0 ); }
+
   ///////////////////////////////////////////////////////////////////
 } // namespace zypp
 ///////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
 #include <zypp/base/PtrTypes.h>
 #include <zypp-core/base/DefaultIntegral>
 #include <zypp/base/String.h>
+#include <zypp/base/StringV.h>
 #include <zypp-media/MediaException>
 #include <zypp/Fetcher.h>
 #include <zypp/ZYppFactory.h>
@@ -630,17 +631,18 @@ namespace zypp
               if ( buffer[0] == '#' )
                 continue;	// simple comment
 
-              CheckSum checksum( str::stripFirstWord( buffer, /*ltrim before strip*/true ) );
+              std::string_view line { buffer };
+              CheckSum checksum( std::string( strv::stripFirstWord( line, /*ltrim before strip*/true ) ) );
               if ( checksum.empty() )
                 continue;	// empty line | unknown cheksum format
 
-              if ( buffer.empty() )
+              if ( line.empty() )
               {
                 WAR << "Missing filename in CHECKSUMS file: " << index.asString() << " (" << checksum << ")" << endl;
                 continue;
               }
 
-              _checksums[(basedir/buffer).asString()] = checksum;
+              _checksums[(basedir/std::string(line)).asString()] = checksum;
           }
       }
       else
@@ -212,7 +212,7 @@ namespace zypp
   KeyRing::Impl::Impl(const filesystem::Pathname &baseTmpDir)
     : _trusted_tmp_dir( baseTmpDir, "zypp-trusted-kr" )
     , _general_tmp_dir( baseTmpDir, "zypp-general-kr" )
-    , _base_dir( baseTmpDir )
+    , _pubkey_arena( baseTmpDir, "zypp-pubkeys" )
   {
     MIL << "Current KeyRing::DefaultAccept: " << _keyRingDefaultAccept << std::endl;
   }
@@ -371,7 +371,7 @@ namespace zypp
 
   filesystem::TmpFile KeyRing::Impl::dumpPublicKeyToTmp( const std::string & id, const Pathname & keyring )
   {
-    filesystem::TmpFile tmpFile( _base_dir, "pubkey-"+id+"-" );
+    filesystem::TmpFile tmpFile( _pubkey_arena.newTmpFile( "pubkey-"+id+"-" ) );
     MIL << "Going to export key [" << id << "] from " << keyring << " to " << tmpFile.path() << endl;
 
     std::ofstream os( tmpFile.path().c_str() );
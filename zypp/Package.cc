@@ -11,6 +11,8 @@
 */
 #include <iostream>
 #include <fstream>
+#include <deque>
+#include <mutex>
 
 #include <zypp/base/LogTools.h>
 #include <zypp/base/String.h>
@@ -236,6 +238,107 @@ namespace zypp
       return Changelog();
   }
 
+  namespace
+  {
+    /** ChangelogView::Source reading the changelog in the solv data on demand.
+     * The strings returned by the solv lookup point into repodata that may be
+     * reused by later lookups or unloaded, so the entries are copied. They are
+     * copied in chunks when first accessed, so iteration stopping at a date or
+     * version does not copy the whole changelog.
+     */
+    struct SolvChangelogSource : public ChangelogView::Source
+    {
+      SolvChangelogSource( sat::Solvable solv_r )
+      : _solv( solv_r )
+      {
+        sat::LookupAttr q( sat::SolvAttr::changelog, _solv );
+        for_( it, q.begin(), q.end() )
+        {
+          if ( it.solvAttrSubEntry() )
+            ++_size;
+        }
+      }
+
+      unsigned size() const override
+      { return _size; }
+
+      Date date( unsigned idx_r ) const override
+      { return entry( idx_r )._date; }
+
+      std::string_view author( unsigned idx_r ) const override
+      { return entry( idx_r )._author; }
+
+      std::string_view text( unsigned idx_r ) const override
+      { return entry( idx_r )._text; }
+
+    private:
+      struct Entry
+      {
+        Date _date;
+        std::string _author;
+        std::string _text;
+      };
+
+      /** The entry at \a idx_r, copying the entries up to it if not yet done.
+       * Doubling the chunk size keeps sequential access linear.
+       */
+      const Entry & entry( unsigned idx_r ) const
+      {
+        std::lock_guard<std::mutex> guard( _mutex );
+        if ( idx_r >= _entries.size() )
+        {
+          unsigned want = std::min( _size, std::max( { idx_r+1, unsigned(2*_entries.size()), 8U } ) );
+          unsigned skip = _entries.size();
+          sat::LookupAttr q( sat::SolvAttr::changelog, _solv );
+          for_( it, q.begin(), q.end() )
+          {
+            if ( ! it.solvAttrSubEntry() )
+              continue;
+            if ( skip )
+            {
+              --skip;
+              continue;
+            }
+            if ( _entries.size() == want )
+              break;
+            _entries.push_back( Entry {
+              Date( it.subFind( "solvable:changelog:time" ).asUnsigned() ),
+              it.subFind( "solvable:changelog:author" ).asString(),
+              it.subFind( "solvable:changelog:text" ).asString() } );
+          }
+          if ( _entries.size() < want )
+          {
+            WAR << _solv << ": changelog changed while reading it" << endl;
+            _entries.resize( want );
+          }
+        }
+        return _entries[idx_r];
+      }
+
+      sat::Solvable _solv;
+      unsigned _size = 0;
+      mutable std::mutex _mutex;
+      mutable std::deque<Entry> _entries;	// stable references on push_back
+    };
+  } // namespace
+
+  ChangelogView Package::changelogView() const
+  {
+      if ( repository().isSystemRepo() )
+      {
+          Target_Ptr target( getZYpp()->getTarget() );
+          if ( ! target )
+          {
+            ERR << "Target not initialized. Changelog is not available." << std::endl;
+            return ChangelogView();
+          }
+          target::rpm::RpmHeader::constPtr header;
+          target->rpmDb().getData(name(), header);
+          return header ? header->tag_changelogView() : ChangelogView(); // might be deleted behind our back (bnc #530595)
+      }
+      return ChangelogView( std::make_shared<SolvChangelogSource>( satSolvable() ) );
+  }
+
   std::string Package::buildhost() const
   { return lookupStrAttribute( sat::SolvAttr::buildhost ); }
 
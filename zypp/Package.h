@@ -85,6 +85,11 @@ namespace zypp
 
     /** Get the package change log */
     Changelog changelog() const;
+    /** The package change log decoded on demand.
+     * Installed packages read it from the rpm header, others from
+     * the repo metadata (if it provides changelogs at all).
+     */
+    ChangelogView changelogView() const;
     /** */
     std::string buildhost() const;
     /** */
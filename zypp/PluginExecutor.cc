@@ -9,6 +9,8 @@
 /** \file	zypp/PluginExecutor.cc
  */
 #include <iostream>
+#include <set>
+#include <vector>
 #include <zypp/base/LogTools.h>
 #include <zypp/base/NonCopyable.h>
 
@@ -55,6 +57,7 @@ namespace zypp
     {
       PathInfo pi( path_r );
       DBG << "+++++++++++++++ load " << pi << endl;
+      std::list<PluginScript> loaded;
       if ( pi.isDir() )
       {
         std::list<Pathname> entries;
@@ -67,13 +70,13 @@ namespace zypp
         {
           PathInfo pii( *it );
           if ( pii.isFile() && pii.userMayRX() )
-            doLoad( pii );
+            doLoad( pii, loaded );
         }
       }
       else if ( pi.isFile() )
       {
         if ( pi.userMayRX() )
-          doLoad( pi );
+          doLoad( pi, loaded );
         else
           WAR << "Plugin file is not executable: " << pi << endl;
       }
@@ -81,15 +84,40 @@ namespace zypp
       {
         WAR << "Plugin path is neither dir nor file: " << pi << endl;
       }
+
+      if ( ! loaded.empty() )
+      {
+        PluginFrame frame( "PLUGINBEGIN" );
+        if ( ZConfig::instance().hasUserData() )
+          frame.setHeader( "userdata", ZConfig::instance().userData() );
+
+        // PLUGINBEGIN is sent to all new plugins concurrently. The ACK tells
+        // whether a plugin must be served in order.
+        std::vector<PluginFrame> acks { dispatch( loaded, frame, /*ordered_r*/false ) };
+        unsigned idx = 0;
+        for ( const PluginScript & plugin : loaded )
+        {
+          if ( plugin.isOpen() )
+          {
+            if ( str::strToTrue( acks[idx].getHeaderNT( "ordered" ) ) )
+            {
+              MIL << "Plugin requests ordered dispatch: " << plugin << endl;
+              _ordered.insert( plugin.getPid() );
+            }
+            _scripts.push_back( plugin );
+          }
+          ++idx;
+        }
+      }
       DBG << "--------------- load " << pi << endl;
     }
 
     void send( const PluginFrame & frame_r )
     {
       DBG << "+++++++++++++++ send " << frame_r << endl;
+      dispatch( _scripts, frame_r, /*ordered_r*/true );
       for ( auto it = _scripts.begin(); it != _scripts.end(); )
       {
-        doSend( *it, frame_r );
         if ( it->isOpen() )
           ++it;
         else
@@ -102,34 +130,83 @@ namespace zypp
     { return _scripts; }
 
   private:
-    /** Launch a plugin sending PLUGINSTART message. */
-    void doLoad( const PathInfo & pi_r )
+    /** Launch a plugin; \c PLUGINBEGIN is sent in \ref load. */
+    void doLoad( const PathInfo & pi_r, std::list<PluginScript> & loaded_r )
     {
       MIL << "Load plugin: " << pi_r << endl;
       try {
         PluginScript plugin( pi_r.path() );
         plugin.open();
+        loaded_r.push_back( plugin );
+      }
+      catch( const zypp::Exception & e )
+      {
+        WAR << "Failed to load plugin " << pi_r << endl;
+      }
+    }
 
-        PluginFrame frame( "PLUGINBEGIN" );
-        if ( ZConfig::instance().hasUserData() )
-          frame.setHeader( "userdata", ZConfig::instance().userData() );
+    /** Send \a frame_r to all \a scripts_r and collect the responses.
+     *
+     * The frame is sent to all plugins before their responses are collected,
+     * so the plugins process it in parallel. Each plugin is bound by its own
+     * receive timeout. A plugin which requested ordered dispatch (and
+     * \a ordered_r is set) receives the frame not before all plugins
+     * preceding it have responded, and is served before any succeeding one.
+     *
+     * Failed plugins are closed. The responses are returned in the order
+     * of \a scripts_r.
+     */
+    std::vector<PluginFrame> dispatch( std::list<PluginScript> & scripts_r, const PluginFrame & frame_r, bool ordered_r )
+    {
+      std::vector<PluginFrame> ret( scripts_r.size() );
+      std::vector<std::pair<PluginScript *, PluginFrame *>> pending;
+
+      auto collectPending = [&]() {
+        for ( auto & [ script, response ] : pending )
+          *response = doReceive( *script, frame_r );
+        pending.clear();
+      };
 
-        doSend( plugin, frame );	// closes on error
-        if ( plugin.isOpen() )
-          _scripts.push_back( plugin );
+      unsigned idx = 0;
+      for ( PluginScript & script : scripts_r )
+      {
+        PluginFrame & response { ret[idx++] };
+        if ( ordered_r && _ordered.count( script.getPid() ) )
+        {
+          collectPending();
+          if ( doSend( script, frame_r ) )
+            response = doReceive( script, frame_r );
+        }
+        else if ( doSend( script, frame_r ) )
+          pending.push_back( { &script, &response } );
+      }
+      collectPending();
+      return ret;
+    }
+
+    /** Send \a frame_r to \a script_r; \c false and closed on error. */
+    bool doSend( PluginScript & script_r, const PluginFrame & frame_r )
+    {
+      try {
+        script_r.send( frame_r );
+        return true;
       }
       catch( const zypp::Exception & e )
       {
-        WAR << "Failed to load plugin " << pi_r << endl;
+        ZYPP_CAUGHT(e);
+        WAR << e.asUserHistory() << endl;
       }
+      WAR << "Failed to send to plugin " << script_r << ": " << frame_r << endl;
+      script_r.close();
+      return false;
     }
 
-    PluginFrame doSend( PluginScript & script_r, const PluginFrame & frame_r )
+    /** Receive the response to \a frame_r from \a script_r; closed on error. */
+    PluginFrame doReceive( PluginScript & script_r, const PluginFrame & frame_r )
     {
       PluginFrame ret;
 
       try {
-        script_r.send( frame_r );
         ret = script_r.receive();
       }
       catch( const zypp::Exception & e )
@@ -150,6 +227,7 @@ namespace zypp
     }
   private:
     std::list<PluginScript> _scripts;
+    std::set<pid_t> _ordered;	///< plugins requesting ordered dispatch
   };
 
   ///////////////////////////////////////////////////////////////////
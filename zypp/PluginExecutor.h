@@ -35,6 +35,14 @@ namespace zypp
   /// executors last reference goes out of scope. Failing PluginScripts are
   /// closed immediately.
   ///
+  /// Frames are dispatched concurrently: a frame is sent to all plugins
+  /// before their responses are collected, so the time spent is bound by the
+  /// slowest plugin rather than the sum of all. Each plugin is bound by its
+  /// own receive timeout (\ref PluginScript::receiveTimeout). A plugin which
+  /// needs to see the frames after all preceding plugins have processed them
+  /// may request ordered dispatch by passing an \c ordered:true header in
+  /// its \c PLUGINBEGIN \c ACK.
+  ///
   /// \see PluginScript
   /// \ingroup g_RAII
   ///////////////////////////////////////////////////////////////////
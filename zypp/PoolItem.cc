@@ -18,6 +18,7 @@
 #include <zypp/ResPool.h>
 #include <zypp/Package.h>
 #include <zypp/VendorAttr.h>
+#include <zypp/pool/StatusTracker.h>
 
 using std::endl;
 
@@ -44,7 +45,13 @@ namespace zypp
             ResStatus &&status_r )
       : _status( std::move(status_r) )
       , _resolvable( std::move(res_r) )
-      {}
+      { if ( _resolvable ) pool::StatusTracker::instance().add( _status, _resolvable->satSolvable() ); }
+
+      Impl( const Impl & ) = delete;
+      Impl & operator=( const Impl & ) = delete;
+
+      ~Impl()
+      { if ( _resolvable ) pool::StatusTracker::instance().remove( _status ); }
 
       ResStatus & status() const
       { return _buddy > 0 ? PoolItem(buddy()).status() : _status; }
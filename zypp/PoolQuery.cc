@@ -17,6 +17,7 @@
 #include <zypp/base/LogTools.h>
 #include <zypp/base/Algorithm.h>
 #include <zypp/base/String.h>
+#include <zypp/base/StringV.h>
 #include <zypp/repo/RepoException.h>
 #include <zypp/RelCompare.h>
 
@@ -249,7 +250,7 @@ namespace zypp
       static AttrMatchData deserialize( const std::string & str_r )
       {
         std::vector<std::string> words;
-        str::splitEscaped( str_r, std::back_inserter(words) );
+        strv::splitEscaped( str_r, [&words]( std::string_view w ) { words.emplace_back( w ); } );
         if ( words.empty() || words[0] != "AttrMatchData" )
           ZYPP_THROW( Exception( str::Str() << "Expecting AttrMatchData: " << str_r ) );
         if ( words.size() != 5 )
@@ -264,7 +265,7 @@ namespace zypp
 
         // now the predicate
         words.clear();
-        str::splitEscaped( ret.predicateStr, std::back_inserter(words) );
+        strv::splitEscaped( ret.predicateStr, [&words]( std::string_view w ) { words.emplace_back( w ); } );
         if ( ! words.empty() )
         {
           if ( words[0] == "EditionRange" )
@@ -1179,8 +1180,9 @@ namespace zypp
 
       finded_something = true;
 
-      std::string attrName(str::trim(std::string(s,0,pos))); // trimmed name of atribute
-      std::string attrValue(str::trim(std::string(s,pos+1,s.npos))); //trimmed value
+      std::string_view line { s };
+      std::string attrName { strv::trim( line.substr( 0, pos ), str::whitespace ) }; // trimmed name of atribute
+      std::string attrValue { strv::trim( line.substr( pos+1 ), str::whitespace ) }; //trimmed value
 
       PoolQueryAttr attribute( attrName );
 
@@ -1282,7 +1284,7 @@ namespace zypp
         {
           pos = attrValue.find_last_of("=<>");
           rel = Rel(attrValue.substr(0, pos+1));
-          attrValue = str::trim(attrValue.substr(pos+1, attrValue.npos));
+          attrValue = std::string( strv::trim( std::string_view(attrValue).substr( pos+1 ), str::whitespace ) );
         }
 
         setEdition(Edition(attrValue), rel);
@@ -1348,7 +1350,7 @@ namespace zypp
         // A candidate for a rewrite?
 
         std::vector<std::string> words;
-        str::splitEscaped( attrmatch.predicateStr, std::back_inserter(words) );
+        strv::splitEscaped( attrmatch.predicateStr, [&words]( std::string_view w ) { words.emplace_back( w ); } );
         if ( words.size() < 4 || words[3].empty() )
         {
           // We have _NO_ arch rule in the complex predicate, so we can simplify it.
@@ -1372,7 +1374,7 @@ namespace zypp
 
           // edition
           std::vector<std::string> words;
-          str::splitEscaped( attrmatch.predicateStr, std::back_inserter(words) );
+          strv::splitEscaped( attrmatch.predicateStr, [&words]( std::string_view w ) { words.emplace_back( w ); } );
           if ( ! words.empty() )
           {
             if ( words[0] == "EditionRange" || words[0] == "SolvableRange" )
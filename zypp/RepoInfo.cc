@@ -29,7 +29,7 @@
 #include <zypp/ZConfig.h>
 #include <zypp/repo/RepoMirrorList.h>
 #include <zypp/repo/SUSEMediaVerifier.h>
-#include <zypp/ExternalProgram.h>
+#include <zypp-core/fs/TarArchive.h>
 
 #include <zypp/base/IOStream.h>
 #include <zypp-core/base/InputStream>
@@ -689,24 +689,14 @@ namespace zypp
     if ( licenseTgz.empty() )
       return false;     // no licenses at all
 
-    ExternalProgram::Arguments cmd;
-    cmd.push_back( "tar" );
-    cmd.push_back( "-t" );
-    cmd.push_back( "-z" );
-    cmd.push_back( "-f" );
-    cmd.push_back( licenseTgz.asString() );
-    ExternalProgram prog( cmd, ExternalProgram::Stderr_To_Stdout );
-
     bool accept = true;
-    static const std::string noAcceptanceFile = "no-acceptance-needed\n";
-    for ( std::string output( prog.receiveLine() ); output.length(); output = prog.receiveLine() )
-    {
-      if ( output == noAcceptanceFile )
-      {
-        accept = false;
-      }
+    static const std::string noAcceptanceFile = "no-acceptance-needed";
+    try {
+      accept = ! filesystem::TarArchive( licenseTgz ).hasMember( noAcceptanceFile );
+    }
+    catch ( const Exception & excpt ) {
+      ZYPP_CAUGHT( excpt );
     }
-    prog.close();
     MIL << "License(" << name_r << ") in " << name() << " has to be accepted: " << (accept?"true":"false" ) << endl;
     return accept;
   }
@@ -739,22 +729,13 @@ namespace zypp
     std::string licenseFile( !getLang ? licenseFileFallback
                                       : str::form( "license.%s.txt", getLang.c_str() ) );
 
-    ExternalProgram::Arguments cmd;
-    cmd.push_back( "tar" );
-    cmd.push_back( "-x" );
-    cmd.push_back( "-z" );
-    cmd.push_back( "-O" );
-    cmd.push_back( "-f" );
-    cmd.push_back( _pimpl->licenseTgz( name_r ).asString() ); // if it not exists, avlocales was empty.
-    cmd.push_back( licenseFile );
-
     std::string ret;
-    ExternalProgram prog( cmd, ExternalProgram::Discard_Stderr );
-    for ( std::string output( prog.receiveLine() ); output.length(); output = prog.receiveLine() )
-    {
-      ret += output;
+    try {
+      ret = filesystem::TarArchive( _pimpl->licenseTgz( name_r ) ).extract( licenseFile ); // if it not exists, avlocales was empty.
+    }
+    catch ( const Exception & excpt ) {
+      ZYPP_CAUGHT( excpt );
     }
-    prog.close();
     return ret;
   }
 
@@ -768,28 +749,26 @@ namespace zypp
     if ( licenseTgz.empty() )
       return LocaleSet();
 
-    ExternalProgram::Arguments cmd;
-    cmd.push_back( "tar" );
-    cmd.push_back( "-t" );
-    cmd.push_back( "-z" );
-    cmd.push_back( "-f" );
-    cmd.push_back( licenseTgz.asString() );
-
     LocaleSet ret;
-    ExternalProgram prog( cmd, ExternalProgram::Stderr_To_Stdout );
-    for ( std::string output( prog.receiveLine() ); output.length(); output = prog.receiveLine() )
-    {
-      static const C_Str license( "license." );
-      static const C_Str dotTxt( ".txt\n" );
-      if ( str::hasPrefix( output, license ) && str::hasSuffix( output, dotTxt ) )
+    try {
+      filesystem::TarArchive tgz( licenseTgz );
+      for ( const auto & member : tgz.members() )
       {
-        if ( output.size() <= license.size() +  dotTxt.size() ) // license.txt
-          ret.insert( Locale() );
-        else
-          ret.insert( Locale( std::string( output.c_str()+license.size(), output.size()- license.size() - dotTxt.size() ) ) );
+        static const C_Str license( "license." );
+        static const C_Str dotTxt( ".txt" );
+        const std::string & output { member.name };
+        if ( member.isFile() && str::hasPrefix( output, license ) && str::hasSuffix( output, dotTxt ) )
+        {
+          if ( output.size() <= license.size() +  dotTxt.size() ) // license.txt
+            ret.insert( Locale() );
+          else
+            ret.insert( Locale( std::string( output.c_str()+license.size(), output.size()- license.size() - dotTxt.size() ) ) );
+        }
       }
     }
-    prog.close();
+    catch ( const Exception & excpt ) {
+      ZYPP_CAUGHT( excpt );
+    }
     return ret;
   }
 
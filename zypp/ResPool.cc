@@ -19,6 +19,7 @@
 #include <zypp/ResPool.h>
 #include <zypp/pool/PoolImpl.h>
 #include <zypp/pool/PoolStats.h>
+#include <zypp/pool/StatusTracker.h>
 
 using std::endl;
 
@@ -59,6 +60,44 @@ namespace zypp
   ResPoolProxy ResPool::proxy() const
   { return _pimpl->proxy( *this ); }
 
+  namespace
+  {
+    /** Append the valid items of \a entries_r to \a result_r. */
+    void collectTransacting( const pool::PoolImpl & pool_r, const pool::StatusTracker::EntrySet & entries_r, std::vector<PoolItem> & result_r )
+    {
+      sat::detail::SolvableIdType lastId = 0;
+      for ( const auto & [id,status] : entries_r )
+      {
+        // An outdated PoolItem may still be around with an id reused by the pool.
+        if ( id == lastId )
+          continue;
+        PoolItem pi { pool_r.find( sat::Solvable( id ) ) };
+        if ( pi && &pi.status() == status )
+        {
+          result_r.push_back( pi );
+          lastId = id;
+        }
+      }
+    }
+  } // namespace
+
+  std::vector<PoolItem> ResPool::transacting() const
+  {
+    _pimpl->store();	// drop outdated items
+    std::vector<PoolItem> ret;
+    for ( const auto & [kind,entries] : pool::StatusTracker::instance().transacting() )
+      collectTransacting( *_pimpl, entries, ret );
+    return ret;
+  }
+
+  std::vector<PoolItem> ResPool::transacting( const ResKind & kind_r ) const
+  {
+    _pimpl->store();	// drop outdated items
+    std::vector<PoolItem> ret;
+    collectTransacting( *_pimpl, pool::StatusTracker::instance().transacting( kind_r ), ret );
+    return ret;
+  }
+
   Resolver & ResPool::resolver() const
   { return *getZYpp()->resolver(); }
 
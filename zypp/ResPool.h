@@ -14,6 +14,7 @@
 
 #include <iosfwd>
 #include <utility>
+#include <vector>
 
 #include <zypp-core/Globals.h>
 #include <zypp/base/Iterator.h>
@@ -113,6 +114,38 @@ namespace zypp
       PoolItem find( const ResObject::constPtr & resolvable_r ) const
       { return( resolvable_r ? find( resolvable_r->satSolvable() ) : PoolItem() ); }
 
+    public:
+      /** \name PoolItems set to transact.
+       *
+       * The pool keeps track of the items set to transact, so listing
+       * or counting them is proportional to the number of pending changes
+       * rather than to the pool size. Use the items \ref ResStatus to tell
+       * who set them (\ref ResStatus::getTransactByValue).
+       * \code
+       *   for ( const PoolItem & pi : pool.transacting<Package>() )
+       *   { ... }
+       * \endcode
+       * \note Items using the status of a buddy (e.g. products) are
+       * reported via the buddy only.
+       */
+      //@{
+      /** All items set to transact, ordered by kind and solvable id. */
+      std::vector<PoolItem> transacting() const;
+      /** Items of \a kind_r set to transact, ordered by solvable id. */
+      std::vector<PoolItem> transacting( const ResKind & kind_r ) const;
+      /** \overload */
+      template<class TRes>
+      std::vector<PoolItem> transacting() const
+      { return transacting( ResTraits<TRes>::kind ); }
+
+      /** Number of items set to transact. */
+      size_type transactingSize() const
+      { return transacting().size(); }
+      /** Number of items of \a kind_r set to transact. */
+      size_type transactingSize( const ResKind & kind_r ) const
+      { return transacting( kind_r ).size(); }
+      //@}
+
     public:
       /** \name Iterate over all PoolItems matching a \c TFilter. */
       //@{
@@ -19,6 +19,7 @@
 
 #include <zypp/ResPoolProxy.h>
 #include <zypp/pool/PoolImpl.h>
+#include <zypp/pool/StatusTracker.h>
 #include <zypp/ui/SelectableImpl.h>
 
 using std::endl;
@@ -27,46 +28,41 @@ using std::endl;
 namespace zypp
 { /////////////////////////////////////////////////////////////////
 
-  /** Tem. friend of PoolItem */
+  /** Save and restore the pool items status.
+   * Uses the copy-on-write snapshots of \ref pool::StatusTracker, so
+   * saving is cheap and restoring touches just the changed items.
+   */
   struct PoolItemSaver
   {
-    void saveState( const ResPool& pool_r )
-    {
-      std::for_each( pool_r.begin(), pool_r.end(),
-                     std::mem_fn(&PoolItem::saveState) );
-    }
+    void saveState( const ResPool & )
+    { pool::StatusTracker::instance().saveState(); }
 
-    void saveState( const ResPool& pool_r, const ResKind & kind_r )
-    {
-      std::for_each( pool_r.byKindBegin(kind_r), pool_r.byKindEnd(kind_r),
-                     std::mem_fn(&PoolItem::saveState) );
-    }
+    void saveState( const ResPool &, const ResKind & kind_r )
+    { pool::StatusTracker::instance().saveState( kind_r ); }
 
-    void restoreState( const ResPool& pool_r )
-    {
-      std::for_each( pool_r.begin(), pool_r.end(),
-                     std::mem_fn(&PoolItem::restoreState) );
-    }
+    void restoreState( const ResPool & )
+    { pool::StatusTracker::instance().restoreState(); }
 
-    void restoreState( const ResPool& pool_r, const ResKind & kind_r )
-    {
-      std::for_each( pool_r.byKindBegin(kind_r), pool_r.byKindEnd(kind_r),
-                     std::mem_fn(&PoolItem::restoreState) );
-    }
+    void restoreState( const ResPool &, const ResKind & kind_r )
+    { pool::StatusTracker::instance().restoreState( kind_r ); }
 
-    bool diffState( const ResPool& pool_r ) const
-    {
-      // return whether some PoolItem::sameState reported \c false.
-      return( invokeOnEach( pool_r.begin(), pool_r.end(),
-                            std::mem_fn(&PoolItem::sameState) ) < 0 );
-    }
+    bool diffState( const ResPool & ) const
+    { return pool::StatusTracker::instance().diffState(); }
 
-    bool diffState( const ResPool& pool_r, const ResKind & kind_r ) const
-    {
-      // return whether some PoolItem::sameState reported \c false.
-      return( invokeOnEach( pool_r.byKindBegin(kind_r), pool_r.byKindEnd(kind_r),
-                            std::mem_fn(&PoolItem::sameState) ) < 0 );
-    }
+    bool diffState( const ResPool &, const ResKind & kind_r ) const
+    { return pool::StatusTracker::instance().diffState( kind_r ); }
+
+    void discardState( const ResPool & )
+    { pool::StatusTracker::instance().discardState(); }
+
+    void discardState( const ResPool &, const ResKind & kind_r )
+    { pool::StatusTracker::instance().discardState( kind_r ); }
+
+    unsigned pushState( const ResPool &, const ResKind & kind_r )
+    { return pool::StatusTracker::instance().pushState( kind_r ); }
+
+    void popState( const ResPool &, unsigned id_r, bool restore_r )
+    { pool::StatusTracker::instance().popState( id_r, restore_r ); }
   };
 
   namespace
@@ -195,6 +191,18 @@ namespace zypp
     bool diffState( const ResKind & kind_r ) const
     { return PoolItemSaver().diffState( _pool, kind_r ); }
 
+    void discardState() const
+    { PoolItemSaver().discardState( _pool ); }
+
+    void discardState( const ResKind & kind_r ) const
+    { PoolItemSaver().discardState( _pool, kind_r ); }
+
+    unsigned pushState( const ResKind & kind_r ) const
+    { return PoolItemSaver().pushState( _pool, kind_r ); }
+
+    void popState( unsigned id_r, bool restore_r ) const
+    { PoolItemSaver().popState( _pool, id_r, restore_r ); }
+
   private:
     ResPool _pool;
     mutable SelectablePool _selPool;
@@ -327,6 +335,18 @@ namespace zypp
   bool ResPoolProxy::diffState( const ResKind & kind_r ) const
   { return _pimpl->diffState( kind_r ); }
 
+  void ResPoolProxy::discardState() const
+  { _pimpl->discardState(); }
+
+  void ResPoolProxy::discardState( const ResKind & kind_r ) const
+  { _pimpl->discardState( kind_r ); }
+
+  unsigned ResPoolProxy::pushState( const ResKind & kind_r ) const
+  { return _pimpl->pushState( kind_r ); }
+
+  void ResPoolProxy::popState( unsigned id_r, bool restore_r ) const
+  { _pimpl->popState( id_r, restore_r ); }
+
   std::ostream & operator<<( std::ostream & str, const ResPoolProxy & obj )
   { return str << *obj._pimpl; }
 
@@ -166,6 +166,12 @@ namespace zypp
      * Diff returns true, if current stat differs from the saved
      * state.
      *
+     * Saving is O(1); the pool remembers the original status of an
+     * item when it is changed for the first time after saving. Restore
+     * and diff touch just these items, so speculative changes are cheap.
+     * While a state is saved, each status change costs a lookup, so call
+     * \ref discardState if the saved state is no longer needed.
+     *
      * Use \ref scopedSaveState for exception safe scoped save/restore
      */
     //@{
@@ -193,11 +199,23 @@ namespace zypp
       bool diffState() const
       { return diffState( ResTraits<TRes>::kind ); }
 
+    void discardState() const;
+
+    void discardState( const ResKind & kind_r ) const;
+
+    template<class TRes>
+      void discardState() const
+      { return discardState( ResTraits<TRes>::kind ); }
+
     /**
      * \class ScopedSaveState
      * \brief Exception safe scoped save/restore state.
      * Call \ref acceptState to prevent the class from restoring
      * the remembered state.
+     *
+     * A ScopedSaveState maintains a saved state of its own. It may be
+     * nested inside other ScopedSaveStates or a \ref saveState without
+     * affecting them.
      * \ingroup g_RAII
      */
     struct ScopedSaveState;
@@ -244,6 +262,12 @@ namespace zypp
         return make_end( TFilter(), kind_r );
       }
 
+  private:
+    /** ScopedSaveState: Start a saved state of its own. */
+    unsigned pushState( const ResKind & kind_r ) const;
+    /** ScopedSaveState: End the saved state \a id_r. */
+    void popState( unsigned id_r, bool restore_r ) const;
+
   private:
     friend class pool::PoolImpl;
     /** Ctor */
@@ -266,35 +290,29 @@ namespace zypp
     NON_COPYABLE_BUT_MOVE( ScopedSaveState );
 
     ScopedSaveState( const ResPoolProxy & pool_r )
-    : _pimpl( new Impl( pool_r ) )
-    { _pimpl->saveState(); }
+    : _pimpl( new Impl( pool_r, ResKind() ) )
+    {}
 
     ScopedSaveState( const ResPoolProxy & pool_r, const ResKind & kind_r )
     : _pimpl( new Impl( pool_r, kind_r ) )
-    { _pimpl->saveState(); }
+    {}
 
     ~ScopedSaveState()
-    { if ( _pimpl ) _pimpl->restoreState(); }
+    { if ( _pimpl ) _pimpl->popState( true ); }
 
     void acceptState()
-    { _pimpl.reset(); }
+    { if ( _pimpl ) { _pimpl->popState( false ); _pimpl.reset(); } }
 
   private:
     struct Impl
     {
-      Impl( const ResPoolProxy & pool_r )
-      : _pool( pool_r )
-      {}
       Impl( const ResPoolProxy & pool_r, const ResKind & kind_r )
-      : _pool( pool_r ), _kind( new ResKind( kind_r ) )
+      : _pool( pool_r ), _id( _pool.pushState( kind_r ) )
       {}
-      void saveState()
-      { if ( _kind ) _pool.saveState( *_kind ); else _pool.saveState(); }
-      void restoreState()
-      { if ( _kind ) _pool.restoreState( *_kind ); else _pool.restoreState(); }
+      void popState( bool restore_r )
+      { _pool.popState( _id, restore_r ); }
       ResPoolProxy _pool;
-      scoped_ptr<ResKind> _kind;
-
+      unsigned _id;
     };
     std::unique_ptr<Impl> _pimpl;
   };
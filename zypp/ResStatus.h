@@ -21,10 +21,27 @@
 namespace zypp
 { /////////////////////////////////////////////////////////////////
 
+  class ResStatus;
+
+  namespace pool
+  {
+    class StatusTracker;
+  }
+
   namespace resstatus
   {
     struct UserLockQueryManip;
     class StatusBackup;
+
+    /** Internal: Tell the pool that \a status_r is about to change to \a newVal_r.
+     * \see \ref pool::StatusTracker
+     */
+    void statusChanging( const ResStatus & status_r, bit::BitField<uint16_t> newVal_r ) ZYPP_API;
+
+    /** Internal: Whether \ref statusChanging wants to see any change,
+     * not just changes of the transact state (i.e. a state is saved).
+     */
+    extern bool trackAllChanges ZYPP_API;
   }
 
   ///////////////////////////////////////////////////////////////////
@@ -165,8 +182,11 @@ namespace zypp
 
     ResStatus(const ResStatus &) = default;
     ResStatus(ResStatus &&) noexcept = default;
-    ResStatus &operator=(const ResStatus &) = default;
-    ResStatus &operator=(ResStatus &&) noexcept = default;
+    /** Assignment is tracked by the pool like any other change (e.g. restoring a saved state). */
+    ResStatus &operator=(const ResStatus & rhs)
+    { bitfieldAssign( rhs._bitfield ); return *this; }
+    ResStatus &operator=(ResStatus && rhs)
+    { bitfieldAssign( rhs._bitfield ); return *this; }
 
     /** Debug helper returning the bitfield.
      * It's save to expose the bitfield, as it can't be used to
@@ -204,16 +224,16 @@ namespace zypp
     { return fieldValueAssign<WeakField>( NO_WEAK ); }
 
     void setRecommended( bool toVal_r = true )
-    { _bitfield.set( RECOMMENDED, toVal_r ); }
+    { bitfieldSet( RECOMMENDED, toVal_r ); }
 
     void setSuggested( bool toVal_r = true )
-    { _bitfield.set( SUGGESTED, toVal_r ); }
+    { bitfieldSet( SUGGESTED, toVal_r ); }
 
     void setOrphaned( bool toVal_r = true )
-    { _bitfield.set( ORPHANED, toVal_r ); }
+    { bitfieldSet( ORPHANED, toVal_r ); }
 
     void setUnneeded( bool toVal_r = true )
-    { _bitfield.set( UNNEEDED, toVal_r ); }
+    { bitfieldSet( UNNEEDED, toVal_r ); }
 
   public:
     ValidateValue validate() const
@@ -381,7 +401,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setTransactValue( newVal_r, causer_r );
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -426,7 +446,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setLock( to_r, causer_r );
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -470,7 +490,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setTransact (val_r, causer);
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -526,7 +546,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setSoftTransact( val_r, causer, causerLimit_r );
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -543,7 +563,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setToBeInstalled (causer);
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -557,7 +577,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setToBeUninstalled (causer);
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -602,7 +622,7 @@ namespace zypp
     {
         bit::BitField<FieldType> savBitfield = _bitfield;
         bool ret = setToBeUninstalledSoft ();
-        _bitfield = savBitfield;
+        bitfieldAssign( savBitfield );
         return ret;
     }
 
@@ -658,7 +678,7 @@ namespace zypp
         return false;
 
       // Ok, we take it all..
-      _bitfield = newStatus_r._bitfield;
+      bitfieldAssign( newStatus_r._bitfield );
       return true;
     }
 
@@ -688,7 +708,34 @@ namespace zypp
     */
     template<class TField>
       void fieldValueAssign( FieldType val_r )
-    { _bitfield.assign<TField>( val_r ); }
+    {
+      BitFieldType newVal { _bitfield };
+      newVal.assign<TField>( val_r );
+      bitfieldAssign( newVal );
+    }
+
+    /** Set or clear the bits in \a mask_r. */
+    void bitfieldSet( FieldType mask_r, bool toVal_r )
+    {
+      BitFieldType newVal { _bitfield };
+      newVal.set( mask_r, toVal_r );
+      bitfieldAssign( newVal );
+    }
+
+    /** Replace the whole bitfield.
+     * All changes pass here, so the pool is able to track them.
+     * Unless a state is saved, just changes of the transact state
+     * are reported.
+     */
+    void bitfieldAssign( BitFieldType newVal_r )
+    {
+      if ( newVal_r == _bitfield )
+        return;
+      if ( resstatus::trackAllChanges
+           || _bitfield.isEqual<TransactField>( TRANSACT ) != newVal_r.isEqual<TransactField>( TRANSACT ) )
+        resstatus::statusChanging( *this, newVal_r );
+      _bitfield = newVal_r;
+    }
 
     /** compare two values.
     */
@@ -702,6 +749,7 @@ namespace zypp
 
   private:
     friend class resstatus::StatusBackup;
+    friend class pool::StatusTracker;
     BitFieldType _bitfield;
   };
   ///////////////////////////////////////////////////////////////////
@@ -740,7 +788,7 @@ namespace zypp
         {}
 
         void replay()
-        { if ( _status ) _status->_bitfield = _bitfield; }
+        { if ( _status ) _status->bitfieldAssign( _bitfield ); }
 
       private:
         ResStatus *             _status;
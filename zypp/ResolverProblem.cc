@@ -76,10 +76,15 @@ namespace zypp
           , _completeProblemInfo ( std::move(completeProblemInfo) )
     {}
 
+    Impl( LazyInit && init )
+    : _lazyInit( std::move(init) )
+    {}
+
     std::string		_description;
     std::string		_details;
     ProblemSolutionList	_solutions;
     std::vector<std::string> _completeProblemInfo;
+    LazyInit		_lazyInit;	///< pending on demand computation
 
   private:
     friend Impl * rwcowClone<Impl>( const Impl * rhs );
@@ -105,30 +110,49 @@ namespace zypp
       : _pimpl( new Impl( std::move(description), std::move(details), std::move(completeProblemInfo) ) )
   {}
 
+  ResolverProblem::ResolverProblem( LazyInit init_r )
+  : _pimpl( new Impl( std::move(init_r) ) )
+  {}
+
   ResolverProblem::~ResolverProblem()
   {}
 
+  void ResolverProblem::lazyInit() const
+  {
+    if ( _pimpl->_lazyInit )
+    {
+      // Take it out first, the setters called by init must not recurse.
+      ResolverProblem & self { const_cast<ResolverProblem &>(*this) };
+      LazyInit init;
+      init.swap( self._pimpl->_lazyInit );
+      init( self );
+    }
+  }
 
   const std::string & ResolverProblem::description() const
-  { return _pimpl->_description; }
+  { lazyInit(); return _pimpl->_description; }
 
   const std::string & ResolverProblem::details() const
-  { return _pimpl->_details; }
+  { lazyInit(); return _pimpl->_details; }
 
   const ProblemSolutionList & ResolverProblem::solutions() const
-  { return _pimpl->_solutions; }
+  { lazyInit(); return _pimpl->_solutions; }
 
   const std::vector<std::string> & ResolverProblem::completeProblemInfo() const
-  { return _pimpl->_completeProblemInfo; }
+  { lazyInit(); return _pimpl->_completeProblemInfo; }
 
   void ResolverProblem::setDescription( std::string description )
-  { _pimpl->_description = std::move(description); }
+  { lazyInit(); _pimpl->_description = std::move(description); }
 
   void ResolverProblem::setDetails( std::string details )
-  { _pimpl->_details = std::move(details); }
+  { lazyInit(); _pimpl->_details = std::move(details); }
+
+  void ResolverProblem::setCompleteProblemInfo( std::vector<std::string> completeProblemInfo )
+  { lazyInit(); _pimpl->_completeProblemInfo = std::move(completeProblemInfo); }
 
   void ResolverProblem::addSolution( const ProblemSolution_Ptr& solution, bool inFront )
   {
+    lazyInit();
     if ( ! solutionInList( _pimpl->_solutions, solution ) )	// bsc#985674: filter duplicate solutions
     {
       if (inFront)
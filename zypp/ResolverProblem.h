@@ -9,6 +9,7 @@
 #ifndef ZYPP_RESOLVERPROBLEM_H
 #define ZYPP_RESOLVERPROBLEM_H
 
+#include <functional>
 #include <list>
 #include <string>
 #include <vector>
@@ -35,6 +36,16 @@ namespace zypp
     /** Constructor. */
     ResolverProblem( std::string description, std::string details, std::vector<std::string> &&completeProblemInfo );
 
+    /** Callback computing the problem data on demand. */
+    using LazyInit = std::function<void( ResolverProblem & )>;
+
+    /** Constructor for a problem computed on demand.
+     * \a init_r is invoked once, on the first access to the problems
+     * description, details or solutions. It is expected to fill in the
+     * data using the setters.
+     */
+    explicit ResolverProblem( LazyInit init_r );
+
     /** Destructor. */
     ~ResolverProblem() override;
 
@@ -82,6 +93,11 @@ namespace zypp
      **/
     void setDetails( std::string details );
 
+    /**
+     * Set the one-line descriptions of the problematic rules.
+     **/
+    void setCompleteProblemInfo( std::vector<std::string> completeProblemInfo );
+
     /**
      * Add a solution to this problem. This class takes over ownership of
      * the problem and will delete it when neccessary.
@@ -89,6 +105,9 @@ namespace zypp
     void addSolution( const ProblemSolution_Ptr& solution, bool inFront = false );
 
   private:
+    /** Run a pending \ref LazyInit. */
+    void lazyInit() const;
+
     struct Impl;
     RWCOW_pointer<Impl> _pimpl;
   };
@@ -19,6 +19,7 @@ extern "C"
 #include <unistd.h>
 #include <solv/solvversion.h>
 }
+#include <atomic>
 #include <iostream>
 #include <fstream>
 #include <optional>
@@ -511,195 +512,7 @@ namespace zypp
         MIL << "libzypp: " LIBZYPP_VERSION_STRING << endl;
         if ( PathInfo(_parsedZyppConf).isExist() )
         {
-          parser::IniDict dict( _parsedZyppConf );
-          for ( IniDict::section_const_iterator sit = dict.sectionsBegin();
-                sit != dict.sectionsEnd();
-                ++sit )
-          {
-            const std::string& section(*sit);
-            //MIL << section << endl;
-            for ( IniDict::entry_const_iterator it = dict.entriesBegin(*sit);
-                  it != dict.entriesEnd(*sit);
-                  ++it )
-            {
-              std::string entry(it->first);
-              std::string value(it->second);
-
-              if ( _mediaConf.setConfigValue( section, entry, value ) )
-                continue;
-
-              //DBG << (*it).first << "=" << (*it).second << endl;
-              if ( section == "main" )
-              {
-                if ( _initialTargetDefaults.consume( entry, value ) )
-                  continue;
-
-                if ( entry == "arch" )
-                {
-                  Arch carch( value );
-                  if ( carch != cfg_arch )
-                  {
-                    WAR << "Overriding system architecture (" << cfg_arch << "): " << carch << endl;
-                    cfg_arch = carch;
-                  }
-                }
-                else if ( entry == "cachedir" )
-                {
-                  cfg_cache_path.restoreToDefault( value );
-                }
-                else if ( entry == "metadatadir" )
-                {
-                  cfg_metadata_path.restoreToDefault( value );
-                }
-                else if ( entry == "solvfilesdir" )
-                {
-                  cfg_solvfiles_path.restoreToDefault( value );
-                }
-                else if ( entry == "packagesdir" )
-                {
-                  cfg_packages_path.restoreToDefault( value );
-                }
-                else if ( entry == "configdir" )
-                {
-                  cfg_config_path = Pathname(value);
-                }
-                else if ( entry == "reposdir" )
-                {
-                  cfg_known_repos_path = Pathname(value);
-                }
-                else if ( entry == "servicesdir" )
-                {
-                  cfg_known_services_path = Pathname(value);
-                }
-                else if ( entry == "varsdir" )
-                {
-                  cfg_vars_path = Pathname(value);
-                }
-                else if ( entry == "repo.add.probe" )
-                {
-                  repo_add_probe = str::strToBool( value, repo_add_probe );
-                }
-                else if ( entry == "repo.refresh.delay" )
-                {
-                  str::strtonum(value, repo_refresh_delay);
-                }
-                else if ( entry == "repo.refresh.locales" )
-                {
-                  std::vector<std::string> tmp;
-                  str::split( value, back_inserter( tmp ), ", \t" );
-
-                  boost::function<Locale(const std::string &)> transform(
-                    [](const std::string & str_r)->Locale{ return Locale(str_r); }
-                  );
-                  repoRefreshLocales.insert( make_transform_iterator( tmp.begin(), transform ),
-                                             make_transform_iterator( tmp.end(), transform ) );
-                }
-                else if ( entry == "download.use_deltarpm" )
-                {
-                  download_use_deltarpm = str::strToBool( value, download_use_deltarpm );
-                }
-                else if ( entry == "download.use_deltarpm.always" )
-                {
-                  download_use_deltarpm_always = str::strToBool( value, download_use_deltarpm_always );
-                }
-                else if ( entry == "download.media_preference" )
-                {
-                  download_media_prefer_download.restoreToDefault( str::compareCI( value, "volatile" ) != 0 );
-                }
-                else if ( entry == "download.media_mountdir" )
-                {
-                  download_mediaMountdir.restoreToDefault( Pathname(value) );
-                }
-                else if ( entry == "download.use_geoip_mirror") {
-                  geoipEnabled = str::strToBool( value, geoipEnabled );
-                }
-                else if ( entry == "commit.downloadMode" )
-                {
-                  commit_downloadMode.set( deserializeDownloadMode( value ) );
-                }
-                else if ( entry == "gpgcheck" )
-                {
-                  gpgCheck.restoreToDefault( str::strToBool( value, gpgCheck ) );
-                }
-                else if ( entry == "repo_gpgcheck" )
-                {
-                  repoGpgCheck.restoreToDefault( str::strToTriBool( value ) );
-                }
-                else if ( entry == "pkg_gpgcheck" )
-                {
-                  pkgGpgCheck.restoreToDefault( str::strToTriBool( value ) );
-                }
-                else if ( entry == "vendordir" )
-                {
-                  cfg_vendor_path = Pathname(value);
-                }
-                else if ( entry == "multiversiondir" )
-                {
-                  cfg_multiversion_path = Pathname(value);
-                }
-                else if ( entry == "multiversion.kernels" )
-                {
-                  cfg_kernel_keep_spec = value;
-                }
-                else if ( entry == "solver.checkSystemFile" )
-                {
-                  solver_checkSystemFile = Pathname(value);
-                }
-                else if ( entry == "solver.checkSystemFileDir" )
-                {
-                  solver_checkSystemFileDir = Pathname(value);
-                }
-                else if ( entry == "multiversion" )
-                {
-                  MultiversionSpec & defSpec( _multiversionMap.getDefaultSpec() );
-                  str::splitEscaped( value, std::inserter( defSpec, defSpec.end() ), ", \t" );
-                }
-                else if ( entry == "locksfile.path" )
-                {
-                  locks_file = Pathname(value);
-                }
-                else if ( entry == "locksfile.apply" )
-                {
-                  apply_locks_file = str::strToBool( value, apply_locks_file );
-                }
-                else if ( entry == "update.datadir" )
-                {
-                  update_data_path = Pathname(value);
-                }
-                else if ( entry == "update.scriptsdir" )
-                {
-                  update_scripts_path = Pathname(value);
-                }
-                else if ( entry == "update.messagessdir" )
-                {
-                  update_messages_path = Pathname(value);
-                }
-                else if ( entry == "update.messages.notify" )
-                {
-                  updateMessagesNotify.set( value );
-                }
-                else if ( entry == "rpm.install.excludedocs" )
-                {
-                  rpmInstallFlags.setFlag( target::rpm::RPMINST_EXCLUDEDOCS,
-                                           str::strToBool( value, false ) );
-                }
-                else if ( entry == "history.logfile" )
-                {
-                  history_log_path = Pathname(value);
-                }
-                else if ( entry == "techpreview.ZYPP_SINGLE_RPMTRANS" )
-                {
-                  DBG << "techpreview.ZYPP_SINGLE_RPMTRANS=" << value << endl;
-                  ::setenv( "ZYPP_SINGLE_RPMTRANS", value.c_str(), 1 );
-                }
-                else if ( entry == "techpreview.ZYPP_MEDIANETWORK" )
-                {
-                  DBG << "techpreview.ZYPP_MEDIANETWORK=" << value << endl;
-                  ::setenv( "ZYPP_MEDIANETWORK", value.c_str(), 1 );
-                }
-              }
-            }
-          }
+          readZyppConf( _parsedZyppConf );
         }
         else
         {
@@ -707,6 +520,13 @@ namespace zypp
           _parsedZyppConf = _parsedZyppConf.extend( " (NOT FOUND)" );
         }
 
+        applyEnvOverrides();
+        MIL << "ZConfig singleton created." << endl;
+      }
+
+      /** Testsuite settings taking precedence over zypp.conf. */
+      void applyEnvOverrides()
+      {
         // legacy:
         if ( getenv( "ZYPP_TESTSUITE_FAKE_ARCH" ) )
         {
@@ -717,7 +537,206 @@ namespace zypp
             cfg_arch = carch;
           }
         }
-        MIL << "ZConfig singleton created." << endl;
+        if ( getenv( "ZYPP_TESTSUITE_PLUGINSDIR" ) )
+        {
+          pluginsPath.set( Pathname( getenv( "ZYPP_TESTSUITE_PLUGINSDIR" ) ) );
+          WAR << "ZYPP_TESTSUITE_PLUGINSDIR: Overriding plugins path: " << pluginsPath.get() << endl;
+        }
+      }
+
+      /** Apply the settings in \a file_r. */
+      void readZyppConf( const Pathname & file_r )
+      {
+        _zyppConfStamp = FileStamp( file_r );
+        parser::IniDict dict( file_r );
+        for ( IniDict::section_const_iterator sit = dict.sectionsBegin();
+              sit != dict.sectionsEnd();
+              ++sit )
+        {
+          const std::string& section(*sit);
+          //MIL << section << endl;
+          for ( IniDict::entry_const_iterator it = dict.entriesBegin(*sit);
+                it != dict.entriesEnd(*sit);
+                ++it )
+          {
+            std::string entry(it->first);
+            std::string value(it->second);
+
+            if ( _mediaConf.setConfigValue( section, entry, value ) )
+              continue;
+
+            //DBG << (*it).first << "=" << (*it).second << endl;
+            if ( section == "main" )
+            {
+              if ( _initialTargetDefaults.consume( entry, value ) )
+                continue;
+
+              if ( entry == "arch" )
+              {
+                Arch carch( value );
+                if ( carch != cfg_arch )
+                {
+                  WAR << "Overriding system architecture (" << cfg_arch << "): " << carch << endl;
+                  cfg_arch = carch;
+                }
+              }
+              else if ( entry == "cachedir" )
+              {
+                cfg_cache_path.restoreToDefault( value );
+              }
+              else if ( entry == "metadatadir" )
+              {
+                cfg_metadata_path.restoreToDefault( value );
+              }
+              else if ( entry == "solvfilesdir" )
+              {
+                cfg_solvfiles_path.restoreToDefault( value );
+              }
+              else if ( entry == "packagesdir" )
+              {
+                cfg_packages_path.restoreToDefault( value );
+              }
+              else if ( entry == "configdir" )
+              {
+                cfg_config_path = Pathname(value);
+              }
+              else if ( entry == "reposdir" )
+              {
+                cfg_known_repos_path = Pathname(value);
+              }
+              else if ( entry == "servicesdir" )
+              {
+                cfg_known_services_path = Pathname(value);
+              }
+              else if ( entry == "varsdir" )
+              {
+                cfg_vars_path = Pathname(value);
+              }
+              else if ( entry == "repo.add.probe" )
+              {
+                repo_add_probe = str::strToBool( value, repo_add_probe );
+              }
+              else if ( entry == "repo.refresh.delay" )
+              {
+                str::strtonum(value, repo_refresh_delay);
+              }
+              else if ( entry == "repo.refresh.locales" )
+              {
+                std::vector<std::string> tmp;
+                str::split( value, back_inserter( tmp ), ", \t" );
+
+                boost::function<Locale(const std::string &)> transform(
+                  [](const std::string & str_r)->Locale{ return Locale(str_r); }
+                );
+                repoRefreshLocales.insert( make_transform_iterator( tmp.begin(), transform ),
+                                           make_transform_iterator( tmp.end(), transform ) );
+              }
+              else if ( entry == "download.use_deltarpm" )
+              {
+                download_use_deltarpm = str::strToBool( value, download_use_deltarpm );
+              }
+              else if ( entry == "download.use_deltarpm.always" )
+              {
+                download_use_deltarpm_always = str::strToBool( value, download_use_deltarpm_always );
+              }
+              else if ( entry == "download.media_preference" )
+              {
+                download_media_prefer_download.restoreToDefault( str::compareCI( value, "volatile" ) != 0 );
+              }
+              else if ( entry == "download.media_mountdir" )
+              {
+                download_mediaMountdir.restoreToDefault( Pathname(value) );
+              }
+              else if ( entry == "download.use_geoip_mirror") {
+                geoipEnabled = str::strToBool( value, geoipEnabled );
+              }
+              else if ( entry == "commit.downloadMode" )
+              {
+                commit_downloadMode.set( deserializeDownloadMode( value ) );
+              }
+              else if ( entry == "gpgcheck" )
+              {
+                gpgCheck.restoreToDefault( str::strToBool( value, gpgCheck ) );
+              }
+              else if ( entry == "repo_gpgcheck" )
+              {
+                repoGpgCheck.restoreToDefault( str::strToTriBool( value ) );
+              }
+              else if ( entry == "pkg_gpgcheck" )
+              {
+                pkgGpgCheck.restoreToDefault( str::strToTriBool( value ) );
+              }
+              else if ( entry == "vendordir" )
+              {
+                cfg_vendor_path = Pathname(value);
+              }
+              else if ( entry == "multiversiondir" )
+              {
+                cfg_multiversion_path = Pathname(value);
+              }
+              else if ( entry == "multiversion.kernels" )
+              {
+                cfg_kernel_keep_spec = value;
+              }
+              else if ( entry == "solver.checkSystemFile" )
+              {
+                solver_checkSystemFile = Pathname(value);
+              }
+              else if ( entry == "solver.checkSystemFileDir" )
+              {
+                solver_checkSystemFileDir = Pathname(value);
+              }
+              else if ( entry == "multiversion" )
+              {
+                MultiversionSpec & defSpec( _multiversionMap.getDefaultSpec() );
+                str::splitEscaped( value, std::inserter( defSpec, defSpec.end() ), ", \t" );
+              }
+              else if ( entry == "locksfile.path" )
+              {
+                locks_file = Pathname(value);
+              }
+              else if ( entry == "locksfile.apply" )
+              {
+                apply_locks_file = str::strToBool( value, apply_locks_file );
+              }
+              else if ( entry == "update.datadir" )
+              {
+                update_data_path = Pathname(value);
+              }
+              else if ( entry == "update.scriptsdir" )
+              {
+                update_scripts_path = Pathname(value);
+              }
+              else if ( entry == "update.messagessdir" )
+              {
+                update_messages_path = Pathname(value);
+              }
+              else if ( entry == "update.messages.notify" )
+              {
+                updateMessagesNotify.set( value );
+              }
+              else if ( entry == "rpm.install.excludedocs" )
+              {
+                rpmInstallFlags.setFlag( target::rpm::RPMINST_EXCLUDEDOCS,
+                                         str::strToBool( value, false ) );
+              }
+              else if ( entry == "history.logfile" )
+              {
+                history_log_path = Pathname(value);
+              }
+              else if ( entry == "techpreview.ZYPP_SINGLE_RPMTRANS" )
+              {
+                DBG << "techpreview.ZYPP_SINGLE_RPMTRANS=" << value << endl;
+                ::setenv( "ZYPP_SINGLE_RPMTRANS", value.c_str(), 1 );
+              }
+              else if ( entry == "techpreview.ZYPP_MEDIANETWORK" )
+              {
+                DBG << "techpreview.ZYPP_MEDIANETWORK=" << value << endl;
+                ::setenv( "ZYPP_MEDIANETWORK", value.c_str(), 1 );
+              }
+            }
+          }
+        }
       }
 
       Impl(const Impl &) = delete;
@@ -726,8 +745,35 @@ namespace zypp
       Impl &operator=(Impl &&) = delete;
       ~Impl() {}
 
+      /** Re-read zypp.conf if its \ref FileStamp changed. */
+      bool reloadIfChanged()
+      {
+        const Pathname confPath { _autodetectZyppConfPath() };
+        FileStamp stamp { confPath };
+        if ( stamp == _zyppConfStamp )
+          return false;
+
+        if ( ! stamp.exists() )
+        {
+          MIL << confPath << " vanished, keeping the current settings." << endl;
+          _zyppConfStamp = stamp;
+          return false;
+        }
+
+        MIL << "Reloading changed " << confPath << endl;
+        // list values are rebuilt from scratch
+        repoRefreshLocales.clear();
+        _multiversionMap = MultiversionMap();
+        _parsedZyppConf = confPath;
+        readZyppConf( confPath );
+        applyEnvOverrides();
+        touch();
+        return true;
+      }
+
       void notifyTargetChanged()
       {
+        touch();
         Pathname newRoot { _autodetectSystemRoot() };
         MIL << "notifyTargetChanged (" << newRoot << ")" << endl;
 
@@ -751,6 +797,46 @@ namespace zypp
       }
 
     public:
+    /** Identifies a version of zypp.conf (inode, mtime and size). */
+    struct FileStamp
+    {
+      FileStamp()
+      {}
+
+      FileStamp( const Pathname & file_r )
+      {
+        PathInfo pi( file_r );
+        if ( pi.isExist() )
+        {
+          _ino = pi.ino();
+          _mtime = pi.mtime();
+          _size = pi.size();
+        }
+      }
+
+      bool exists() const
+      { return _ino; }
+
+      bool operator==( const FileStamp & rhs ) const
+      { return _ino == rhs._ino && _mtime == rhs._mtime && _size == rhs._size; }
+
+      bool operator!=( const FileStamp & rhs ) const
+      { return ! ( *this == rhs ); }
+
+    private:
+      ino_t  _ino = 0;
+      time_t _mtime = 0;
+      off_t  _size = 0;
+    };
+
+    /** Start a new \ref ZConfig::Snapshot generation. */
+    void touch()
+    { ++_generation; }
+
+    std::atomic<unsigned> _generation { 1 };
+    mutable ZConfig::SnapshotPtr _snapshot;	///< Access via std::atomic_load/atomic_store only.
+    FileStamp _zyppConfStamp;
+
     /** Remember any parsed zypp.conf. */
     Pathname _parsedZyppConf;
 
@@ -950,6 +1036,50 @@ namespace zypp
   void ZConfig::notifyTargetChanged()
   { return _pimpl->notifyTargetChanged(); }
 
+  ZConfig::SnapshotPtr ZConfig::snapshot() const
+  {
+    const unsigned gen { _pimpl->_generation.load() };
+    SnapshotPtr ret { std::atomic_load( &_pimpl->_snapshot ) };
+    if ( ret && ret->generation == gen )
+      return ret;
+
+    // Concurrent callers may build the same generation twice; either result is fine.
+    auto snap { std::make_shared<Snapshot>() };
+    snap->generation                          = gen;
+    snap->systemArchitecture                  = systemArchitecture();
+    snap->repoCachePath                       = repoCachePath();
+    snap->repoMetadataPath                    = repoMetadataPath();
+    snap->repoSolvfilesPath                   = repoSolvfilesPath();
+    snap->repoPackagesPath                    = repoPackagesPath();
+    snap->download_use_deltarpm               = download_use_deltarpm();
+    snap->download_use_deltarpm_always        = download_use_deltarpm_always();
+    snap->download_media_prefer_download      = download_media_prefer_download();
+    snap->download_max_concurrent_connections = download_max_concurrent_connections();
+    snap->download_min_download_speed         = download_min_download_speed();
+    snap->download_max_download_speed         = download_max_download_speed();
+    snap->download_max_silent_tries           = download_max_silent_tries();
+    snap->download_transfer_timeout           = download_transfer_timeout();
+    snap->commit_downloadMode                 = commit_downloadMode();
+    snap->gpgCheck                            = gpgCheck();
+    snap->repoGpgCheck                        = repoGpgCheck();
+    snap->pkgGpgCheck                         = pkgGpgCheck();
+
+    ret = snap;
+    std::atomic_store( &_pimpl->_snapshot, ret );
+    return ret;
+  }
+
+  unsigned ZConfig::generation() const
+  { return _pimpl->_generation.load(); }
+
+  bool ZConfig::reloadIfChanged()
+  {
+    if ( ! _pimpl->reloadIfChanged() )
+      return false;
+    sat::detail::PoolMember::myPool().multiversionSpecChanged();
+    return true;
+  }
+
   Pathname ZConfig::systemRoot() const
   { return _autodetectSystemRoot(); }
 
@@ -983,6 +1113,7 @@ namespace zypp
     {
       WAR << "Overriding system architecture (" << _pimpl->cfg_arch << "): " << arch_r << endl;
       _pimpl->cfg_arch = arch_r;
+      _pimpl->touch();
     }
   }
 
@@ -1053,6 +1184,7 @@ namespace zypp
   void ZConfig::setRepoCachePath(const zypp::filesystem::Pathname &path_r)
   {
     _pimpl->cfg_cache_path = path_r;
+    _pimpl->touch();
   }
 
   Pathname ZConfig::repoMetadataPath() const
@@ -1064,6 +1196,7 @@ namespace zypp
   void ZConfig::setRepoMetadataPath(const zypp::filesystem::Pathname &path_r)
   {
     _pimpl->cfg_metadata_path = path_r;
+    _pimpl->touch();
   }
 
   Pathname ZConfig::repoSolvfilesPath() const
@@ -1075,6 +1208,7 @@ namespace zypp
   void ZConfig::setRepoSolvfilesPath(const zypp::filesystem::Pathname &path_r)
   {
     _pimpl->cfg_solvfiles_path = path_r;
+    _pimpl->touch();
   }
 
   Pathname ZConfig::repoPackagesPath() const
@@ -1086,6 +1220,7 @@ namespace zypp
   void ZConfig::setRepoPackagesPath(const zypp::filesystem::Pathname &path_r)
   {
     _pimpl->cfg_packages_path = path_r;
+    _pimpl->touch();
   }
 
   Pathname ZConfig::builtinRepoCachePath() const
@@ -1183,10 +1318,10 @@ namespace zypp
   { return _pimpl->download_media_prefer_download; }
 
   void ZConfig::set_download_media_prefer_download( bool yesno_r )
-  { _pimpl->download_media_prefer_download.set( yesno_r ); }
+  { _pimpl->download_media_prefer_download.set( yesno_r ); _pimpl->touch(); }
 
   void ZConfig::set_default_download_media_prefer_download()
-  { _pimpl->download_media_prefer_download.restoreToDefault(); }
+  { _pimpl->download_media_prefer_download.restoreToDefault(); _pimpl->touch(); }
 
   long ZConfig::download_max_concurrent_connections() const
   { return _pimpl->_mediaConf.download_max_concurrent_connections(); }
@@ -1215,13 +1350,13 @@ namespace zypp
   TriBool ZConfig::repoGpgCheck() const			{ return _pimpl->repoGpgCheck; }
   TriBool ZConfig::pkgGpgCheck() const			{ return _pimpl->pkgGpgCheck; }
 
-  void ZConfig::setGpgCheck( bool val_r )		{ _pimpl->gpgCheck.set( val_r ); }
-  void ZConfig::setRepoGpgCheck( TriBool val_r )	{ _pimpl->repoGpgCheck.set( val_r ); }
-  void ZConfig::setPkgGpgCheck( TriBool val_r )		{ _pimpl->pkgGpgCheck.set( val_r ); }
+  void ZConfig::setGpgCheck( bool val_r )		{ _pimpl->gpgCheck.set( val_r ); _pimpl->touch(); }
+  void ZConfig::setRepoGpgCheck( TriBool val_r )	{ _pimpl->repoGpgCheck.set( val_r ); _pimpl->touch(); }
+  void ZConfig::setPkgGpgCheck( TriBool val_r )		{ _pimpl->pkgGpgCheck.set( val_r ); _pimpl->touch(); }
 
-  void ZConfig::resetGpgCheck()				{ _pimpl->gpgCheck.restoreToDefault(); }
-  void ZConfig::resetRepoGpgCheck()			{ _pimpl->repoGpgCheck.restoreToDefault(); }
-  void ZConfig::resetPkgGpgCheck()			{ _pimpl->pkgGpgCheck.restoreToDefault(); }
+  void ZConfig::resetGpgCheck()				{ _pimpl->gpgCheck.restoreToDefault(); _pimpl->touch(); }
+  void ZConfig::resetRepoGpgCheck()			{ _pimpl->repoGpgCheck.restoreToDefault(); _pimpl->touch(); }
+  void ZConfig::resetPkgGpgCheck()			{ _pimpl->pkgGpgCheck.restoreToDefault(); _pimpl->touch(); }
 
 
   ResolverFocus ZConfig::solver_focus() const           { return _pimpl->targetDefaults().solver_focus; }
@@ -13,6 +13,7 @@
 #define ZYPP_ZCONFIG_H
 
 #include <iosfwd>
+#include <memory>
 #include <set>
 #include <string>
 
@@ -573,6 +574,69 @@ namespace zypp
 
       //@}
 
+    public:
+      /** \name Config snapshot
+       *
+       * An immutable copy of frequently used settings. Hot paths can take a
+       * snapshot and read plain fields instead of calling the individual
+       * accessors. A snapshot is never modified; a setter of a covered value, a
+       * \ref notifyTargetChanged or a reload of zypp.conf creates a new
+       * generation and the next \ref snapshot call returns a fresh one.
+       * Snapshots are shared and may be read concurrently.
+       * \code
+       *   ZConfig::SnapshotPtr cfg { ZConfig::instance().snapshot() };
+       *   if ( cfg->download_use_deltarpm ) ...
+       * \endcode
+       */
+      //@{
+      struct Snapshot
+      {
+        unsigned generation = 0;	///< The \ref ZConfig::generation this snapshot was taken from
+
+        Arch     systemArchitecture;
+        Pathname repoCachePath;
+        Pathname repoMetadataPath;
+        Pathname repoSolvfilesPath;
+        Pathname repoPackagesPath;
+
+        bool     download_use_deltarpm = true;
+        bool     download_use_deltarpm_always = false;
+        bool     download_media_prefer_download = true;
+        long     download_max_concurrent_connections = 0;
+        long     download_min_download_speed = 0;
+        long     download_max_download_speed = 0;
+        long     download_max_silent_tries = 0;
+        long     download_transfer_timeout = 0;
+        DownloadMode commit_downloadMode = DownloadDefault;
+
+        bool     gpgCheck = true;
+        TriBool  repoGpgCheck;
+        TriBool  pkgGpgCheck;
+      };
+      using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+      /** The current config snapshot (created on demand). */
+      SnapshotPtr snapshot() const;
+
+      /** Counter increased whenever a setting covered by the \ref Snapshot may have changed. */
+      unsigned generation() const;
+
+      /** Re-read zypp.conf if the file was replaced or modified since it was parsed.
+       *
+       * The file is considered changed if its inode, mtime or size differ.
+       * Entries present in the file are applied like at startup, so they
+       * \b override values set via the API (e.g. \ref setRepoCachePath).
+       * Entries removed from the file keep their current value.
+       *
+       * This is meant for long running applications and is never done
+       * implicitly. It is not thread safe: the caller must make sure no
+       * other thread uses ZConfig (including \ref snapshot) meanwhile.
+       *
+       * \return Whether the file was re-read.
+       */
+      bool reloadIfChanged();
+      //@}
+
     public:
       class Impl;
 
@@ -15,6 +15,7 @@ extern "C"
 }
 #include <iostream>
 #include <fstream>
+#include <mutex>
 #include <signal.h>
 
 #include <zypp/base/Logger.h>
@@ -32,6 +33,7 @@ extern "C"
 #include <boost/interprocess/sync/file_lock.hpp>
 #include <boost/interprocess/sync/scoped_lock.hpp>
 #include <boost/interprocess/sync/sharable_lock.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <utility>
 
 #include <iostream>
@@ -88,10 +90,7 @@ namespace zypp
       MIL << "ZYPP_READONLY promised." <<  endl;
     }
 
-    bool IGotIt()
-    {
-      return active;
-    }
+    bool IGotIt();	// below, a shared ZYpp session is read-only as well
 
     /////////////////////////////////////////////////////////////////
   } // namespace zypp_readonly_hack
@@ -107,7 +106,7 @@ namespace zypp
   public:
     ZYppGlobalLock(Pathname &&lFilePath)
       : _zyppLockFilePath(std::move(lFilePath)), _zyppLockFile(NULL),
-        _lockerPid(0), _cleanLock(false) {
+        _lockerPid(0), _cleanLock(false), _shared(false), _sharedLocked(false) {
       filesystem::assert_dir(_zyppLockFilePath.dirname() );
     }
 
@@ -118,6 +117,12 @@ namespace zypp
 
     ~ZYppGlobalLock()
     {
+        if ( _sharedLocked )
+        try {
+          _closeLockFile();	// releases the shared lock
+        }
+        catch(...) {} // let no exception escape.
+
         if ( _cleanLock )
         try {
           // Exception safe access to the lockfile.
@@ -142,6 +147,13 @@ namespace zypp
     const Pathname & zyppLockFilePath() const
     { return _zyppLockFilePath; }
 
+    /** Whether this is the lock of a shared (read-only) session. */
+    bool shared() const
+    { return _shared; }
+
+    void setShared()
+    { _shared = true; }
+
 
   private:
     Pathname	_zyppLockFilePath;
@@ -151,6 +163,8 @@ namespace zypp
     pid_t	_lockerPid;
     std::string _lockerName;
     bool	_cleanLock;
+    bool	_shared;	// a read-only session
+    bool	_sharedLocked;	// we hold the shared lock until we are done
 
   private:
     using ScopedGuard = shared_ptr<void>;
@@ -287,6 +301,9 @@ namespace zypp
     }
 
     /** Try to aquire a lock.
+     * Writers hold the write lock just while checking and writing their pid,
+     * but readers hold a read lock as long as their session lasts. So we wait
+     * a moment for the write lock and otherwise consider zypp to be locked.
      * \return \c true if zypp is already locked by another process.
      */
     bool zyppLocked()
@@ -296,7 +313,13 @@ namespace zypp
 
       // Exception safe access to the lockfile.
       ScopedGuard closeOnReturn( accessLockFile() );
-      scoped_lock<file_lock> flock( _zyppLockFileLock );	// aquire write lock
+      scoped_lock<file_lock> flock( _zyppLockFileLock, boost::posix_time::microsec_clock::universal_time() + boost::posix_time::seconds(1) );
+      if ( ! flock.owns() ) {
+        WAR << "Read-only sessions hold " << _zyppLockFilePath << ". Sorry." << std::endl;
+        _lockerPid = 0;
+        _lockerName = "read-only sessions";
+        return true;
+      }
       if ( !safeCheckIsLocked() ) {
         writeLockFile();
         return false;
@@ -304,13 +327,189 @@ namespace zypp
       return true;
     }
 
+    /** Try to aquire a read lock for a read-only session.
+     * The read lock is held until the session ends. It keeps writers out,
+     * but not other readers.
+     * \return \c true if zypp is locked by a writer.
+     */
+    bool zyppLockedShared()
+    {
+      if ( geteuid() != 0 )
+        return false;	// no lock as non-root
+      if ( _sharedLocked )
+        return false;
+
+      _openLockFile();
+      _zyppLockFileLock.lock_sharable();	// writers hold the write lock just for a moment
+      if ( safeCheckIsLocked() ) {
+        _closeLockFile();
+        return true;
+      }
+      _sharedLocked = true;
+      return false;
+    }
+
   };
 
+  ///////////////////////////////////////////////////////////////////
+  /// \class ZYppCacheLockFile
+  /// \brief Process wide fcntl record lock on \c zypp-cache.lock backing \ref ZYppCacheLock.
+  ///
+  /// Counts the shared and exclusive holders within the process, so the
+  /// underlying lock is acquired, upgraded and released only if needed.
+  ///
+  /// Converting a shared fcntl lock into an exclusive one fails with
+  /// \c EDEADLK if another process tries the same at the same time. So an
+  /// upgrade releases the shared lock and waits for the exclusive one.
+  /// Meanwhile another writer may publish, so the shared holders lose
+  /// their snapshot guarantee.
+  ///////////////////////////////////////////////////////////////////
+  class ZYppCacheLockFile
+  {
+  public:
+    static ZYppCacheLockFile & instance()
+    {
+      static ZYppCacheLockFile _instance;
+      return _instance;
+    }
+
+    void acquire( ZYppCacheLock::Mode mode_r )
+    {
+      std::lock_guard<std::mutex> guard( _mutex );
+      if ( ! assertLockFile() )
+        return;
+
+      try {
+        if ( mode_r == ZYppCacheLock::Exclusive )
+        {
+          if ( _exclusive == 0 )
+          {
+            if ( _shared )
+            {
+              WAR << "Upgrade cache lock " << _path << ": releasing the shared lock, the snapshot may change." << endl;
+              _lock.unlock();
+            }
+            else
+              DBG << "Acquire exclusive cache lock " << _path << endl;
+            _lock.lock();
+          }
+          ++_exclusive;
+        }
+        else
+        {
+          if ( _shared == 0 && _exclusive == 0 )
+          {
+            DBG << "Acquire shared cache lock " << _path << endl;
+            _lock.lock_sharable();
+          }
+          ++_shared;
+        }
+      }
+      catch ( const boost::interprocess::interprocess_exception & excpt ) {
+        if ( _shared && _exclusive == 0 )
+        {
+          // failed upgrade: try to get back what the shared holders had
+          try { _lock.lock_sharable(); }
+          catch ( const boost::interprocess::interprocess_exception & ) {}
+        }
+        ZYPP_THROW( Exception( "Can't lock " + _path.asString() + ": " + excpt.what() ) );
+      }
+    }
+
+    void release( ZYppCacheLock::Mode mode_r )
+    {
+      std::lock_guard<std::mutex> guard( _mutex );
+      if ( ! _lockFile )
+        return;
+
+      if ( mode_r == ZYppCacheLock::Exclusive )
+      {
+        if ( --_exclusive == 0 )
+        {
+          if ( _shared )
+          {
+            DBG << "Convert cache lock to shared " << _path << endl;
+            _lock.lock_sharable();
+          }
+          else
+            _lock.unlock();
+        }
+      }
+      else
+      {
+        if ( --_shared == 0 && _exclusive == 0 )
+          _lock.unlock();
+      }
+    }
+
+  private:
+    ZYppCacheLockFile()
+    : _path( ZYppFactory::lockfileDir() / "zypp-cache.lock" )
+    {}
+
+    ~ZYppCacheLockFile()
+    {
+      // see ZYppGlobalLock::_closeLockFile: release the lock before closing the file.
+      _lock = file_lock();
+      if ( _lockFile )
+        fclose( _lockFile );
+    }
+
+    /** Open the lockfile once. \c false if not possible (lock is a no-op). */
+    bool assertLockFile()
+    {
+      if ( _lockFile )
+        return true;
+      if ( _failed )
+        return false;
+
+      filesystem::assert_dir( _path.dirname() );
+      _lockFile = fopen( _path.c_str(), "a+" );
+      if ( _lockFile == NULL )
+      {
+        _failed = true;
+        MIL << "Can't open " << _path << ". Not using the cache lock." << endl;
+        return false;
+      }
+      try {
+        _lock = file_lock( _path.c_str() );
+      }
+      catch ( const boost::interprocess::interprocess_exception & excpt ) {
+        _failed = true;
+        WAR << "Can't lock " << _path << " (" << excpt.what() << "). Not using the cache lock." << endl;
+        fclose( _lockFile );
+        _lockFile = NULL;
+        return false;
+      }
+      return true;
+    }
+
+  private:
+    std::mutex	_mutex;
+    Pathname	_path;
+    FILE *	_lockFile = NULL;
+    file_lock	_lock;
+    unsigned	_shared = 0;
+    unsigned	_exclusive = 0;
+    bool	_failed = false;
+  };
+
+  ZYppCacheLock::ZYppCacheLock( Mode mode_r )
+  : _mode( mode_r )
+  { ZYppCacheLockFile::instance().acquire( _mode ); }
+
+  ZYppCacheLock::~ZYppCacheLock()
+  {
+    try { ZYppCacheLockFile::instance().release( _mode ); }
+    catch(...) {} // let no exception escape.
+  }
+
   ///////////////////////////////////////////////////////////////////
   namespace
   {
     static weak_ptr<ZYpp>		_theZYppInstance;
     static scoped_ptr<ZYppGlobalLock>	_theGlobalLock;		// on/off in sync with _theZYppInstance
+    static ZYppFactory::LockMode	_theLockMode = ZYppFactory::LockMode::Exclusive;
 
     ZYppGlobalLock & globalLock()
     {
@@ -321,6 +520,11 @@ namespace zypp
   } //namespace
   ///////////////////////////////////////////////////////////////////
 
+  bool zypp_readonly_hack::IGotIt()
+  {
+    return active || ( _theGlobalLock && _theGlobalLock->shared() );
+  }
+
   ///////////////////////////////////////////////////////////////////
   //
   //	CLASS NAME : ZYpp
@@ -373,6 +577,9 @@ namespace zypp
   ///////////////////////////////////////////////////////////////////
   //
   ZYpp::Ptr ZYppFactory::getZYpp() const
+  { return getZYpp( LockMode::Exclusive ); }
+
+  ZYpp::Ptr ZYppFactory::getZYpp( LockMode mode_r ) const
   {
 
     const auto &makeLockedError = []( pid_t pid, const std::string &lockerName ){
@@ -381,9 +588,20 @@ namespace zypp
       return ZYppFactoryException(t, pid, lockerName );
     };
 
+    // readers take the shared lock, writers the exclusive one
+    const auto &zyppLocked = [mode_r]() {
+      return mode_r == LockMode::Shared ? globalLock().zyppLockedShared() : globalLock().zyppLocked();
+    };
+
     ZYpp::Ptr _instance = _theZYppInstance.lock();
     if ( ! _instance )
     {
+      if ( mode_r == LockMode::Shared )
+      {
+        globalLock().setShared();
+        MIL << "Shared lock mode: read-only session" << endl;
+      }
+
       if ( geteuid() != 0 )
       {
         MIL << "Running as user. Skip creating " << globalLock().zyppLockFilePath() << std::endl;
@@ -392,7 +610,7 @@ namespace zypp
       {
         MIL << "ZYPP_READONLY active." << endl;
       }
-      else if ( globalLock().zyppLocked() )
+      else if ( zyppLocked() )
       {
         bool failed = true;
         // bsc#1184399,1213231: A negative ZYPP_LOCK_TIMEOUT will wait forever.
@@ -422,7 +640,7 @@ namespace zypp
             sleep( delay );
             {
               zypp::base::LogControl::TmpLineWriter shutUp;     // be quiet
-              failed = globalLock().zyppLocked();
+              failed = zyppLocked();
             }
           } while ( failed && ( not giveup || Date::now() <= giveup ) );
 
@@ -453,6 +671,12 @@ namespace zypp
         _theImplInstance.reset( new ZYpp::Impl );
       _instance.reset( new ZYpp( _theImplInstance ) );
       _theZYppInstance = _instance;
+      _theLockMode = mode_r;
+    }
+    else if ( mode_r != _theLockMode )
+    {
+      WAR << "Requested lock mode " << (mode_r == LockMode::Shared ? "Shared" : "Exclusive")
+          << " ignored. ZYpp instance already exists." << endl;
     }
 
     return _instance;
@@ -463,6 +687,12 @@ namespace zypp
   bool ZYppFactory::haveZYpp() const
   { return !_theZYppInstance.expired(); }
 
+  ZYppFactory::LockMode ZYppFactory::lockMode()
+  { return _theLockMode; }
+
+  bool ZYppFactory::readOnly()
+  { return zypp_readonly_hack::IGotIt(); }
+
   zypp::Pathname ZYppFactory::lockfileDir()
   {
     return env::ZYPP_LOCKFILE_ROOT() / "run";
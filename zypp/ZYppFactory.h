@@ -50,12 +50,47 @@ namespace zypp
     /** Dtor */
     ~ZYppFactory();
 
+  public:
+    /** How the ZYpp instance locks the system.
+     * \see \ref getZYpp( LockMode )
+     */
+    enum class LockMode
+    {
+      Exclusive,	///< Default: The global zypp lock is acquired; may modify the system.
+      Shared		///< Read-only session; coexists with other readers and a writer.
+    };
+
   public:
     /** \return Pointer to the ZYpp instance.
      * \throw EXCEPTION In case we can't acquire a lock.
     */
     ZYpp::Ptr getZYpp() const;
 
+    /** \return Pointer to the ZYpp instance using \a mode_r to lock the system.
+     *
+     * A \ref LockMode::Shared session holds a read lock on the global zypp
+     * lock file, so any number of readers may run concurrently while writers
+     * are kept out. The session is read-only (like the former readonly hack).
+     * Writers publish the solv caches atomically under an exclusive
+     * \ref ZYppCacheLock, readers load them under a shared one, so a reader
+     * never sees half built cache files. To get a consistent snapshot across
+     * several repos, hold a shared \ref ZYppCacheLock while loading them.
+     *
+     * If a ZYpp instance already exists, it is returned unchanged. The lock
+     * mode can not be changed until the instance is gone.
+     *
+     * \throw EXCEPTION In case we can't acquire a lock.
+     */
+    ZYpp::Ptr getZYpp( LockMode mode_r ) const;
+
+    /** The \ref LockMode of the current (or last) ZYpp instance. */
+    static LockMode lockMode();
+
+    /** Whether the current ZYpp instance is a read-only session
+     * (\ref LockMode::Shared or \c ZYPP_READONLY_HACK).
+     */
+    static bool readOnly();
+
     /** Whether the ZYpp instance is already created.*/
     bool haveZYpp() const;
 
@@ -67,6 +102,60 @@ namespace zypp
   };
   ///////////////////////////////////////////////////////////////////
 
+  ///////////////////////////////////////////////////////////////////
+  /// \class ZYppCacheLock
+  /// \brief Reader/writer lock guarding the published repo caches.
+  ///
+  /// Writers hold an \ref Exclusive lock while publishing (replacing or
+  /// removing) a solv cache, readers hold a \ref Shared lock while loading
+  /// them. The lock is reentrant within the process. It is converted back
+  /// to \ref Shared when the last \ref Exclusive lock is released.
+  ///
+  /// A \ref Exclusive lock requested while holding a \ref Shared one does
+  /// not convert the lock atomically. The shared lock is released first
+  /// and the exclusive lock acquired afterwards. Meanwhile other writers
+  /// may publish their caches, so the \ref Shared holders lose their
+  /// snapshot guarantee. E.g. \c loadFromCache takes an \ref Exclusive
+  /// lock if it needs to rebuild a cache.
+  ///
+  /// \code
+  ///   {
+  ///     ZYppCacheLock snapshot;	// consistent snapshot of all repo caches
+  ///     for ( const auto & repo : repoManager.knownRepositories() )
+  ///       repoManager.loadFromCache( repo );
+  ///   }
+  /// \endcode
+  ///
+  /// \note If the lockfile can not be created (e.g. running as user),
+  /// the lock silently degrades to a no-op.
+  ///////////////////////////////////////////////////////////////////
+  class ZYPP_API ZYppCacheLock
+  {
+  public:
+    enum Mode { Shared, Exclusive };
+
+    /** Ctor acquiring the lock in \a mode_r (blocking).
+     * \throws Exception if locking fails.
+     */
+    explicit ZYppCacheLock( Mode mode_r = Shared );
+
+    ZYppCacheLock( const ZYppCacheLock & ) = delete;
+    ZYppCacheLock( ZYppCacheLock && ) = delete;
+    ZYppCacheLock & operator=( const ZYppCacheLock & ) = delete;
+    ZYppCacheLock & operator=( ZYppCacheLock && ) = delete;
+
+    /** Dtor releasing the lock. */
+    ~ZYppCacheLock();
+
+    /** The mode this lock was acquired in. */
+    Mode mode() const
+    { return _mode; }
+
+  private:
+    Mode _mode;
+  };
+  ///////////////////////////////////////////////////////////////////
+
   /** \relates ZYppFactory Stream output */
   std::ostream & operator<<( std::ostream & str, const ZYppFactory & obj );
 
@@ -77,6 +166,13 @@ namespace zypp
   inline ZYpp::Ptr getZYpp()
   { return ZYppFactory::instance().getZYpp(); }
 
+  /** \relates ZYppFactory Convenience to get the Pointer
+   * to the ZYpp instance using a specific \ref ZYppFactory::LockMode.
+   * \see ZYppFactory::getZYpp( ZYppFactory::LockMode )
+  */
+  inline ZYpp::Ptr getZYpp( ZYppFactory::LockMode mode_r )
+  { return ZYppFactory::instance().getZYpp( mode_r ); }
+
   /////////////////////////////////////////////////////////////////
 } // namespace zypp
 ///////////////////////////////////////////////////////////////////
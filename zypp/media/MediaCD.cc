@@ -21,6 +21,9 @@ extern "C"
 #include <cstring> // strerror
 #include <cstdlib> // getenv
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <optional>
 
 #include <zypp/base/Logger.h>
 #include <zypp/ExternalProgram.h>
@@ -123,6 +126,41 @@ namespace zypp
         return detected;
       }
 
+      //////////////////////////////////////////////////////////////////
+      /// \brief Remember the \ref systemDetectDevices result
+      ///
+      /// Enumerating the devices is done on each attach. Drives don't come
+      /// and go that often, so the result is reused until an attach fails.
+      //////////////////////////////////////////////////////////////////
+      struct DetectedDevicesCache
+      {
+        static DetectedDevicesCache & instance()
+        {
+          static DetectedDevicesCache _instance;
+          return _instance;
+        }
+
+        DeviceList get( bool supportingDVD_r )
+        {
+          std::lock_guard<std::mutex> guard( _lock );
+          std::optional<DeviceList> & entry { _cache[supportingDVD_r] };
+          if ( ! entry )
+            entry = systemDetectDevices( supportingDVD_r );
+          return *entry;
+        }
+
+        void clear()
+        {
+          std::lock_guard<std::mutex> guard( _lock );
+          _cache[0].reset();
+          _cache[1].reset();
+        }
+
+      private:
+        std::mutex _lock;
+        std::optional<DeviceList> _cache[2];
+      };
+
     } // namespace
     //////////////////////////////////////////////////////////////////
 
@@ -193,7 +231,7 @@ namespace zypp
 
   MediaCD::DeviceList MediaCD::detectDevices( bool supportingDVD_r ) const
   {
-    DeviceList detected( systemDetectDevices( supportingDVD_r ) );
+    DeviceList detected( DetectedDevicesCache::instance().get( supportingDVD_r ) );
 
     if ( detected.empty() )
     {
@@ -294,6 +332,23 @@ namespace zypp
     if ( _url.getScheme() == "dvd" )
       filesystems.push_back("udf");
 
+    // Status of the drives we may need to mount. They are probed (trays
+    // closed, waiting for the drives to spin up) in parallel, as soon as
+    // the first one is about to be mounted.
+    std::optional<std::map<std::string,CDTools::DriveStatus>> probed;
+    const auto probeRemaining = [&]( DeviceList::const_iterator it_r ) {
+      std::vector<std::string> devices;
+      for ( ; it_r != _devices.end(); ++it_r )
+      {
+        if ( PathInfo( it_r->name ).isBlk() )
+          devices.push_back( it_r->name );
+      }
+      std::vector<CDTools::DriveStatus> status( CDTools::probeDevices( devices ) );
+      probed.emplace();
+      for ( unsigned i = 0; i < devices.size(); ++i )
+        (*probed)[devices[i]] = status[i];
+    };
+
     // try all devices in sequence
     int count = 0;
     std::string mountpoint( attachPoint().asString() );
@@ -384,7 +439,13 @@ namespace zypp
       }
 
       // close tray
-      closeTray( it->name );
+      if ( ! probed )
+        probeRemaining( it );
+      if ( ! CDTools::mayHaveDisc( (*probed)[it->name] ) )
+      {
+        DBG << "skipping device without disc " << it->name << endl;
+        continue;
+      }
 
       // try all filesystems in sequence
       for(std::list<std::string>::iterator fsit = filesystems.begin()
@@ -450,6 +511,7 @@ namespace zypp
     if (!mountsucceeded)
     {
       _lastdev = -1;
+      DetectedDevicesCache::instance().clear();	// maybe a drive was plugged in
 
       if( !merr.mountOutput().empty())
       {
@@ -152,6 +152,8 @@ namespace internal {
         _dispatcher = zyppng::ThreadData::current().ensureDispatcher();
         _downloader = std::make_shared<zyppng::Downloader>();
         _downloader->requestDispatcher()->setMaximumConcurrentConnections( zypp::MediaConfig::instance().download_max_concurrent_connections() );
+        // what we learned about the servers is kept across sessions
+        _downloader->setCapabilityCacheDir( zypp::ZConfig::instance().repoCachePath() / "netcaps" );
       }
   };
 
@@ -10,7 +10,10 @@
  *
 */
 #include <iostream>
+#include <mutex>
 #include <zypp/base/Logger.h>
+#include <zypp/base/String.h>
+#include <zypp/Date.h>
 #include <zypp/media/UrlResolverPlugin.h>
 #include <zypp-media/MediaException>
 #include <zypp/PluginScript.h>
@@ -33,51 +36,173 @@ namespace zypp
     };
     ///////////////////////////////////////////////////////////////////
 
-    Url UrlResolverPlugin::resolveUrl(const Url & o_url, HeaderList &headers)
+    namespace
     {
-        if (o_url.getScheme() != "plugin")
-            return o_url;
+      /** Reply header telling how long (sec.) a result may be cached. Not passed on as HTTP header. */
+      const std::string ttlHeader { "X-Zypp-Resolver-TTL" };
+      /** Reply header asking to keep the plugin running for further requests. Not passed on as HTTP header. */
+      const std::string sessionHeader { "X-Zypp-Resolver-Session" };
+
+      ///////////////////////////////////////////////////////////////////
+      /// \class ResolverSessions
+      /// \brief Running url resolver plugins and the cached results.
+      ///
+      /// A plugin is closed after each reply unless it asked to be kept
+      /// running by passing a \ref sessionHeader.
+      ///////////////////////////////////////////////////////////////////
+      class ResolverSessions
+      {
+      public:
+        using HeaderList = UrlResolverPlugin::HeaderList;
+
+        /** A plugins reply prepared for use. */
+        struct Result
+        {
+          Url _url;
+          HeaderList _headers;
+          Date _expires;	// 0: do not cache
+          bool _keepSession = false;
+        };
+
+        static ResolverSessions & instance()
+        {
+          static ResolverSessions _instance;
+          return _instance;
+        }
+
+        /** Resolve the \c plugin: \a url_r. */
+        Result resolve( const Url & url_r )
+        {
+          std::lock_guard<std::mutex> guard( _mutex );
+
+          auto cached { _cache.find( cacheKey( url_r ) ) };
+          if ( cached != _cache.end() )
+          {
+            if ( Date::now() < cached->second._expires )
+            {
+              DBG << "Cached: " << url_r << " -> " << cached->second._url << endl;
+              return cached->second;
+            }
+            _cache.erase( cached );
+          }
+
+          const std::string & name { url_r.getPathName() };
+          Pathname plugin_path = (ZConfig::instance().pluginsPath()/"urlresolver")/name;
+          if ( ! PathInfo(plugin_path).isExist() )
+            return Result { url_r };
+
+          PluginFrame r;
+          auto session { _sessions.find( name ) };
+          if ( session != _sessions.end() )
+          {
+            try {
+              r = ask( session->second, url_r );
+            }
+            catch ( const PluginScriptException & excpt )
+            {
+              // The plugin terminated since the last request. Restart it.
+              ZYPP_CAUGHT( excpt );
+              MIL << "Restarting url resolver " << plugin_path << endl;
+              _sessions.erase( session );
+              session = _sessions.end();
+            }
+          }
+          if ( session == _sessions.end() )
+          {
+            session = _sessions.emplace( name, PluginScript() ).first;
+            PluginScript & scr { session->second };
+            try {
+              scr.open( plugin_path );
+              r = ask( scr, url_r );
+            }
+            catch ( ... )
+            {
+              _sessions.erase( session );
+              throw;
+            }
+          }
+
+          Result res { url_r };
+          if ( r.command() == "RESOLVEDURL" )
+          {
+            res = evalReply( r );
+            if ( res._expires )
+              _cache[cacheKey( url_r )] = res;
+          }
 
-        Url url(o_url);
-        std::string name = url.getPathName();
-        Pathname plugin_path = (ZConfig::instance().pluginsPath()/"urlresolver")/name;
-        if (PathInfo(plugin_path).isExist()) {
-            PluginScript scr;
-            scr.open(plugin_path);
-            // send frame to plugin
-            PluginFrame f("RESOLVEURL");
-
-            url::ParamMap params = url.getQueryStringMap();
-            url::ParamMap::const_iterator param_it;
-            for( param_it = params.begin();
-                 param_it != params.end();
-                 ++param_it)
-                f.setHeader(param_it->first, param_it->second);
-
-            scr.send(f);
-
-            PluginFrame r(scr.receive());
-            if (r.command() == "RESOLVEDURL") {
-                // now set
-                url = Url(r.body().asString());
-                PluginFrame::HeaderListIterator it;
-
-                for (it = r.headerBegin();
-                     it != r.headerEnd();
-                     ++it) {
-                    std::pair<std::string, std::string> values(*it);
-                    // curl resets headers that are empty, so we use a workaround
-                    if (values.second.empty()) {
-                        values.second = "\r\nX-libcurl-Empty-Header-Workaround: *";
-                    }
-                    headers.insert(values);
-                }
+          if ( ! res._keepSession )
+            _sessions.erase( session );	// closes the plugin
+
+          if ( r.command() == "ERROR" )
+            ZYPP_THROW(MediaException(r.body().asString()));
+          return res;
+        }
+
+      private:
+        /** The cache key: plugin name and query (ParamMap is sorted). */
+        static std::string cacheKey( const Url & url_r )
+        {
+          str::Str key;
+          key << url_r.getPathName();
+          for ( const auto & [ k, v ] : url_r.getQueryStringMap() )
+            key << '\n' << k << '=' << v;
+          return key;
+        }
+
+        static PluginFrame ask( PluginScript & scr_r, const Url & url_r )
+        {
+          PluginFrame f("RESOLVEURL");
+          for ( const auto & [ k, v ] : url_r.getQueryStringMap() )
+            f.setHeader( k, v );
+          scr_r.send( f );
+          return scr_r.receive();
+        }
+
+        static Result evalReply( const PluginFrame & r )
+        {
+          Result ret;
+          ret._url = Url(r.body().asString());
+
+          for ( PluginFrame::HeaderListIterator it = r.headerBegin(); it != r.headerEnd(); ++it )
+          {
+            std::pair<std::string, std::string> values(*it);
+            if ( values.first == ttlHeader )
+            {
+              Date::ValueType ttl { str::strtonum<Date::ValueType>( values.second ) };
+              if ( ttl > 0 )
+                ret._expires = Date::now() + ttl;
+              continue;
+            }
+            if ( values.first == sessionHeader )
+            {
+              ret._keepSession = true;
+              continue;
             }
-            else if (r.command() == "ERROR") {
-                ZYPP_THROW(MediaException(r.body().asString()));
+            // curl resets headers that are empty, so we use a workaround
+            if (values.second.empty()) {
+              values.second = "\r\nX-libcurl-Empty-Header-Workaround: *";
             }
+            ret._headers.insert(values);
+          }
+          return ret;
         }
-        return url;
+
+      private:
+        std::mutex _mutex;
+        std::map<std::string, PluginScript> _sessions;	// by plugin name
+        std::map<std::string, Result> _cache;		// by cacheKey
+      };
+    } // namespace
+    ///////////////////////////////////////////////////////////////////
+
+    Url UrlResolverPlugin::resolveUrl(const Url & o_url, HeaderList &headers)
+    {
+        if (o_url.getScheme() != "plugin")
+            return o_url;
+
+        ResolverSessions::Result res { ResolverSessions::instance().resolve( o_url ) };
+        headers.insert( res._headers.begin(), res._headers.end() );
+        return res._url;
     }
 
     /** \relates UrlResolverPlugin::Impl Stream output */
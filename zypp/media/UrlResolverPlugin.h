@@ -44,6 +44,15 @@ namespace zypp
        * its current value.
        *
        * Custom headers are inserted in the provided header list
+       *
+       * By default a plugin is started for each request and closed after
+       * the reply. A plugin passing a \c X-Zypp-Resolver-Session
+       * header in its \c RESOLVEDURL reply is kept running for the session,
+       * and subsequent requests are sent over the same connection. If it
+       * terminated meanwhile, it is restarted. A plugin may pass a
+       * \c X-Zypp-Resolver-TTL header (seconds) in its \c RESOLVEDURL
+       * reply, allowing the result to be cached for that long. Without
+       * it results are not cached.
        */
       static Url resolveUrl(const Url &url, HeaderList &headers);
 
@@ -17,6 +17,7 @@
 #include <zypp/base/LogControl.h>
 #include <zypp/base/LogTools.h>
 #include <zypp/base/String.h>
+#include <zypp/base/StringV.h>
 #include <zypp/base/Gettext.h>
 #include <zypp/base/Exception.h>
 
@@ -291,55 +292,60 @@ namespace zypp
   */
   inline void CheckAccessDeleted::Impl::addCacheIf( CacheEntry & cache_r, const std::string & line_r, std::vector<std::string> *debMap )
   {
-    const char * f = 0;
-    const char * t = 0;
-    const char * n = 0;
-
-    for_( ch, line_r.c_str(), ch+line_r.size() )
-    {
-      switch ( *ch )
+    // NOTE: line contains '\0' separated fields! Fields end with a '\0', so
+    // the views are NUL terminated.
+    std::string_view f;
+    std::string_view t;
+    std::string_view n;
+    bool skip = false;	// non-zero link count
+    bool eod = false;	// end of data
+
+    strv::split( line_r, std::string_view( "\0", 1 ), [&]( std::string_view field_r ) {
+      if ( skip || eod || field_r.empty() )
+        return;
+      switch ( field_r[0] )
       {
         case 'k':
-          if ( *(ch+1) != '0' )	// skip non-zero link counts
-            return;
+          if ( field_r.size() < 2 || field_r[1] != '0' )	// skip non-zero link counts
+            skip = true;
           break;
         case 'f':
-          f = ch+1;
+          f = field_r.substr( 1 );
           break;
         case 't':
-          t = ch+1;
+          t = field_r.substr( 1 );
           break;
         case 'n':
-          n = ch+1;
+          n = field_r.substr( 1 );
+          break;
+        case '\n':
+          eod = true;
           break;
       }
-      if ( *ch == '\n' ) break;		// end of data
-      do { ++ch; } while ( *ch != '\0' );	// skip to next field
-    }
+    } );
+
+    if ( skip )
+      return;
 
-    if ( !t || !f || !n )
+    if ( !t.data() || !f.data() || !n.data() )
       return;	// wrong filedescriptor/type/name
 
-    if ( !(    ( *t == 'R' && *(t+1) == 'E' && *(t+2) == 'G' && *(t+3) == '\0' )
-            || ( *t == 'D' && *(t+1) == 'E' && *(t+2) == 'L' && *(t+3) == '\0' ) ) )
+    if ( !( t == "REG" || t == "DEL" ) )
       return;	// wrong type
 
-    if ( !(    ( *f == 'm' && *(f+1) == 'e' && *(f+2) == 'm' && *(f+3) == '\0' )
-            || ( *f == 't' && *(f+1) == 'x' && *(f+2) == 't' && *(f+3) == '\0' )
-            || ( *f == 'D' && *(f+1) == 'E' && *(f+2) == 'L' && *(f+3) == '\0' )
-            || ( *f == 'l' && *(f+1) == 't' && *(f+2) == 'x' && *(f+3) == '\0' ) ) )
+    if ( !( f == "mem" || f == "txt" || f == "DEL" || f == "ltx" ) )
       return;	// wrong filedescriptor type
 
-    if ( str::contains( n, "(stat: Permission denied)" ) )
+    if ( n.find( "(stat: Permission denied)" ) != n.npos )
       return;	// Avoid reporting false positive due to insufficient permission.
 
     if ( ! _verbose )
     {
-      if ( ! ( str::contains( n, "/lib" ) || str::contains( n, "bin/" ) ) )
+      if ( ! ( n.find( "/lib" ) != n.npos || n.find( "bin/" ) != n.npos ) )
         return; // Try to avoid reporting false positive unless verbose.
     }
 
-    if ( *f == 'm' || *f == 'D' )	// skip some wellknown nonlibrary memorymapped files
+    if ( f[0] == 'm' || f[0] == 'D' )	// skip some wellknown nonlibrary memorymapped files
     {
       static const char * black[] = {
           "/SYSV"
@@ -352,15 +358,16 @@ namespace zypp
       };
       for_( it, arrayBegin( black ), arrayEnd( black ) )
       {
-        if ( str::hasPrefix( n, *it ) )
+        if ( strv::hasPrefix( n, *it ) )
           return;
       }
     }
     // Add if no duplicate
-    if ( debMap && cache_r.second.find(n) == cache_r.second.end() ) {
+    std::string file { n };
+    if ( debMap && cache_r.second.find(file) == cache_r.second.end() ) {
       debMap->push_back(line_r);
     }
-    cache_r.second.insert( n );
+    cache_r.second.insert( std::move(file) );
   }
 
   CheckAccessDeleted::CheckAccessDeleted( bool doCheck_r )
@@ -402,7 +409,7 @@ namespace zypp
       // NOTE: line contains '\0' separeated fields!
       if ( line[0] == 'p' )
       {
-        str::strtonum( line.c_str()+1, cachepid );	// line is "p<PID>\0...."
+        cachepid = strv::strtonum<pid_t>( std::string_view( line ).substr( 1 ) );	// line is "p<PID>\0...."
         if ( _fromLsofFileMode || !runsInLXC( cachepid ) ) {
           if ( debugEnabled ) {
             auto &pidMad = debugMap[cachepid];
@@ -20,6 +20,7 @@
 
 #include <zypp/ExternalProgram.h>
 #include <zypp/HistoryLog.h>
+#include <zypp/ZYppFactory.h>
 #include <zypp/base/Algorithm.h>
 #include <zypp/ng/Context>
 #include <zypp/ng/workflows/logichelpers.h>
@@ -760,8 +761,11 @@ namespace zyppng::RepoManagerWorkflow {
               case zypp::repo::RepoType::YAST2_e :
               case zypp::repo::RepoType::RPMPLAINDIR_e :
               {
-                // Take care we unlink the solvfile on error
-                zypp::ManagedFile guard( solvfile, zypp::filesystem::unlink );
+                // repo2solv writes to a temporary file which is published atomically
+                // on success. Readers never see a half built solv file.
+                // Take care we unlink the temporary solvfile on error.
+                zypp::Pathname tmpsolvfile { solvfile.extend( ".new" ) };
+                zypp::ManagedFile guard( tmpsolvfile, zypp::filesystem::unlink );
 
                 zypp::ExternalProgram::Arguments cmd;
 #ifdef ZYPP_REPO2SOLV_PATH
@@ -771,7 +775,7 @@ namespace zyppng::RepoManagerWorkflow {
 #endif
                 // repo2solv expects -o as 1st arg!
                 cmd.push_back( "-o" );
-                cmd.push_back( solvfile.asString() );
+                cmd.push_back( tmpsolvfile.asString() );
                 cmd.push_back( "-X" );	// autogenerate pattern from pattern-package
                 // bsc#1104415: no more application support // cmd.push_back( "-A" );	// autogenerate application pseudo packages
 
@@ -792,6 +796,13 @@ namespace zyppng::RepoManagerWorkflow {
 
                 return Repo2SolvOp<ZyppContextRefType>::run( info, std::move(cmd) )
                 | and_then( [this, guard = std::move(guard), solvfile = std::move(solvfile) ]() mutable {
+                  try {
+                    zypp::ZYppCacheLock publish( zypp::ZYppCacheLock::Exclusive );
+                    if ( zypp::filesystem::rename( guard, solvfile ) != 0 )
+                      return expected<void>::error( ZYPP_EXCPT_PTR( zypp::repo::RepoException( zypp::str::Format(_("Failed to cache repo %1%")) % _refCtx->repoInfo() ) ) );
+                  } catch (...) {
+                    return expected<void>::error( ZYPP_FWD_CURRENT_EXCPT() );
+                  }
                   // We keep it.
                   guard.resetDispose();
                   return mtry( zypp::sat::updateSolvFileIndex, solvfile ); // content digest for zypper bash completion
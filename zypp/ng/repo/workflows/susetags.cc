@@ -7,7 +7,8 @@
 |                                                                      |
 \---------------------------------------------------------------------*/
 #include "susetags.h"
-#include "zypp-core/base/Regex.h"
+#include <zypp-core/base/StringV.h>
+#include <optional>
 #include <zypp-core/zyppng/ui/ProgressObserver>
 #include <zypp-media/ng/ProvideSpec>
 #include <zypp/ng/Context>
@@ -31,6 +32,23 @@ namespace zyppng::SuseTagsWorkflows {
 
     using namespace zyppng::operators;
 
+    /** The extension of a \c packages[.<ext>][.gz] file name (empty for plain \c packages).
+     * \returns \c std::nullopt if \a name_r is no packages file.
+     */
+    std::optional<std::string_view> packagesFileExt( std::string_view name_r )
+    {
+      if ( ! zypp::strv::hasPrefix( name_r, "packages" ) )
+        return std::nullopt;
+      name_r.remove_prefix( 8 );
+      if ( zypp::strv::hasSuffix( name_r, ".gz" ) )
+        name_r.remove_suffix( 3 );
+      if ( name_r.empty() )
+        return name_r;
+      if ( name_r[0] != '.' || name_r.find( '.', 1 ) != std::string_view::npos )
+        return std::nullopt;
+      return name_r.substr( 1 );
+    }
+
     /*!
      * Implementation of the susetags status calculation logic
      *
@@ -176,20 +194,18 @@ namespace zyppng::SuseTagsWorkflows {
                         // omit unwanted translations
                         if ( zypp::str::hasPrefix( it->first, "packages" ) )
                         {
-                          static const zypp::str::regex rx_packages( "^packages((.gz)?|(.([^.]*))(.gz)?)$" );
-                          zypp::str::smatch what;
-
-                          if ( zypp::str::regex_match( it->first, what, rx_packages ) ) {
-                            if ( what[4].empty() // packages(.gz)?
-                              || what[4] == "DU"
-                              || what[4] == "en" )
+                          const auto & ext { packagesFileExt( it->first ) };
+                          if ( ext ) {
+                            if ( ext->empty() // packages(.gz)?
+                              || *ext == "DU"
+                              || *ext == "en" )
                             { ; /* always downloaded */ }
-                            else if ( what[4] == "FL" )
+                            else if ( *ext == "FL" )
                             { continue; /* never downloaded */ }
                             else
                             {
                               // remember and decide later
-                              availablePackageTranslations[what[4]] = it;
+                              availablePackageTranslations[std::string(*ext)] = it;
                               continue;
                             }
                           }
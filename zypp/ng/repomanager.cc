@@ -22,6 +22,7 @@
 #include <zypp/HistoryLog.h>
 #include <zypp/ZConfig.h>
 #include <zypp/ZYppCallbacks.h>
+#include <zypp/ZYppFactory.h>
 #include <zypp/base/LogTools.h>
 #include <zypp/parser/RepoFileReader.h>
 #include <zypp/parser/ServiceFileReader.h>
@@ -504,7 +505,10 @@ namespace zyppng
     ProgressObserver::start( myProgress );
 
     MIL << "Removing raw metadata cache for " << info.alias() << std::endl;
-    zypp::filesystem::recursive_rmdir(solv_path_for_repoinfo(_options, info).unwrap());
+    {
+      zypp::ZYppCacheLock publish( zypp::ZYppCacheLock::Exclusive );
+      zypp::filesystem::recursive_rmdir(solv_path_for_repoinfo(_options, info).unwrap());
+    }
 
     ProgressObserver::finish( myProgress );
     return expected<void>::success();
@@ -527,6 +531,8 @@ namespace zyppng
       assert_alias(info).unwrap();
       zypp::Pathname solvfile = solv_path_for_repoinfo(_options, info).unwrap() / "solv";
 
+      // Writers publish the solv file under an exclusive lock.
+      zypp::ZYppCacheLock snapshot( zypp::ZYppCacheLock::Shared );
       if ( ! zypp::PathInfo(solvfile).isExist() )
         ZYPP_THROW(zypp::repo::RepoNotCachedException(info));
 
@@ -554,6 +560,7 @@ namespace zyppng
           return buildCache ( info, zypp::RepoManagerFlags::BuildIfNeeded, ProgressObserver::makeSubTask( myProgress ) );
         })
         | and_then( mtry([this, info = info]{
+          zypp::ZYppCacheLock snapshot( zypp::ZYppCacheLock::Shared );
           _zyppContext->satPool().addRepoSolv( solv_path_for_repoinfo(_options, info).unwrap() / "solv", info );
         }));
     })
@@ -36,6 +36,10 @@ namespace zyppng {
 
     ZYPP_DECL_PRIVATE_CONSTR_ARGS(CacheProviderContext, ZyppContextRefType zyppContext, zypp::Pathname destDir );
 
+    static std::shared_ptr<CacheProviderContext> create( ZyppContextRefType zyppContext, zypp::Pathname destDir ) {
+      return std::make_shared<CacheProviderContext>( private_constr_t{}, std::move(zyppContext), std::move(destDir) );
+    }
+
     const ContextRefType &zyppContext() const;
     const zypp::Pathname &destDir() const;
 
@@ -0,0 +1,199 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+
+#include "srcpackagewf.h"
+#include <zypp/ng/workflows/logichelpers.h>
+
+#include <zypp/ng/Context>
+#include <zypp/ng/workflows/contextfacade.h>
+#include <zypp/ng/workflows/downloadwf.h>
+
+#include <zypp-core/zyppng/pipelines/Algorithm>
+#include <zypp-media/ng/Provide>
+#include <zypp-media/ng/ProvideSpec>
+
+#include <zypp/Package.h>
+#include <zypp/ResPool.h>
+#include <zypp/Resolver.h>
+#include <zypp/SrcPackage.h>
+
+#include <map>
+#include <unordered_map>
+
+namespace zyppng::SrcPackageWorkflow {
+
+  using namespace zyppng::operators;
+
+  namespace {
+
+    /** A file to provide and where to put it. */
+    struct StageJob
+    {
+      zypp::RepoInfo        _repo;
+      zypp::OnMediaLocation _location;
+      zypp::Pathname        _destDir;
+      std::vector<unsigned> _srcIdx;  ///< where the file goes in StagedBuild::_srcPackages; empty for build requirements
+    };
+
+    template <class Executor, class OpType>
+    struct StageBuildLogic : public LogicBase<Executor, OpType> {
+    protected:
+
+      ZYPP_ENABLE_LOGIC_BASE(Executor, OpType);
+
+      using ZyppContextRefType = MaybeAsyncContextRef<OpType>;
+      using ZyppContextType    = remove_smart_ptr_t<ZyppContextRefType>;
+      using ProvideType        = typename ZyppContextType::ProvideType;
+      using MediaHandle        = typename ProvideType::MediaHandle;
+      using CacheProviderContextType = CacheProviderContext<ZyppContextRefType>;
+
+      /** The provided file and the StageJob::_srcIdx it belongs to. */
+      using StagedFile = std::pair<std::vector<unsigned>, zypp::ManagedFile>;
+
+    public:
+      StageBuildLogic( ZyppContextRefType &&ctx, std::vector<zypp::SrcPackage_constPtr> &&srcPackages, zypp::Pathname &&srcDestDir )
+        : _ctx( std::move(ctx) )
+        , _srcPackages( std::move(srcPackages) )
+        , _srcDestDir( std::move(srcDestDir) )
+      {}
+
+      MaybeAsyncRef<expected<StagedBuild>> execute() {
+
+        std::vector<std::vector<StageJob>> media;
+        try {
+          resolveBuildRequires();
+          media = collectJobs();
+        } catch ( ... ) {
+          return makeReadyResult( expected<StagedBuild>::error( ZYPP_FWD_CURRENT_EXCPT() ) );
+        }
+
+        // every medium is attached once, its files are provided in parallel
+        return transform_collect( std::move(media), [this]( std::vector<StageJob> jobs ) {
+
+          const StageJob & first { jobs.front() };
+          std::vector<zypp::Url> urls;
+          for ( zypp::Url url : first._repo.baseUrls() ) {
+            url.setPathName( zypp::Pathname( url.getPathName() ) / first._repo.path() );
+            urls.push_back( std::move(url) );
+          }
+          const ProvideMediaSpec spec( first._repo.name(), zypp::Pathname(), first._location.medianr() );
+
+          return _ctx->provider()->attachMedia( urls, spec )
+          | and_then( [this, jobs = std::move(jobs)]( MediaHandle medium ) mutable {
+            return transform_collect( std::move(jobs), [this, medium]( StageJob job ) {
+              return DownloadWorkflow::provideToCacheDir( CacheProviderContextType::create( _ctx, job._destDir ), medium, job._location.filename(), ProvideFileSpec( job._location ) )
+              | and_then( [ idx = std::move(job._srcIdx) ]( zypp::ManagedFile &&file ) mutable {
+                return make_expected_success( StagedFile( std::move(idx), std::move(file) ) );
+              });
+            });
+          });
+
+        })
+        | and_then( [this]( std::vector<std::vector<StagedFile>> &&staged ) {
+          StagedBuild ret;
+          ret._srcPackages.resize( _srcPackages.size() );
+          for ( auto & onMedium : staged ) {
+            for ( auto & file : onMedium ) {
+              if ( file.first.empty() )
+                ret._buildRequires.push_back( std::move(file.second) );
+              else {
+                for ( unsigned idx : file.first )
+                  ret._srcPackages[idx] = file.second;
+              }
+            }
+          }
+          MIL << "Staged " << _srcPackages.size() << " source packages and " << ret._buildRequires.size() << " build requirements" << std::endl;
+          return make_expected_success( std::move(ret) );
+        });
+      }
+
+    protected:
+      /** Let the resolver select the build requirements of all source packages. */
+      void resolveBuildRequires() {
+        zypp::CapabilitySet buildRequires;
+        for ( const auto & srcPackage : _srcPackages ) {
+          for ( const auto & cap : srcPackage->dep( zypp::Dep::REQUIRES ) ) {
+            // rpmlib() features are not provided by any package
+            if ( ! zypp::str::hasPrefix( cap.detail().name().asString(), "rpmlib(" ) )
+              buildRequires.insert( cap );
+          }
+        }
+        MIL << "Resolving " << buildRequires.size() << " distinct build requirements of " << _srcPackages.size() << " source packages" << std::endl;
+
+        // remember which requirements were added, so a failed attempt leaves the resolver as it was
+        zypp::Resolver & resolver { _ctx->pool().resolver() };
+        const zypp::CapabilitySet known { resolver.getRequire() };
+        std::vector<zypp::Capability> added;
+        for ( const auto & cap : buildRequires ) {
+          if ( known.count( cap ) )
+            continue;
+          resolver.addRequire( cap );
+          added.push_back( cap );
+        }
+
+        if ( ! resolver.resolvePool() ) {
+          for ( const auto & cap : added )
+            resolver.removeRequire( cap );
+          ZYPP_THROW( zypp::Exception( "Unable to resolve the build requirements." ) );
+        }
+      }
+
+      /** The files to provide, grouped by medium. */
+      std::vector<std::vector<StageJob>> collectJobs() {
+        std::map<std::pair<std::string,unsigned>, std::vector<StageJob>> media;
+        const auto addJob = [&media]( StageJob && job ) {
+          media[std::make_pair( job._repo.alias(), job._location.medianr() )].push_back( std::move(job) );
+        };
+
+        // the same source package may be requested more than once
+        std::unordered_map<zypp::sat::Solvable::IdType, StageJob> srcJobs;
+        for ( unsigned i = 0; i < _srcPackages.size(); ++i ) {
+          const auto & srcPackage { _srcPackages[i] };
+          auto & job { srcJobs[srcPackage->satSolvable().id()] };
+          if ( job._srcIdx.empty() ) {
+            job._repo     = srcPackage->repoInfo();
+            job._location = srcPackage->location();
+            job._destDir  = _srcDestDir;
+          }
+          job._srcIdx.push_back( i );
+        }
+        for ( auto & srcJob : srcJobs )
+          addJob( std::move(srcJob.second) );
+
+        for ( const zypp::PoolItem & pi : _ctx->pool().template byKind<zypp::Package>() ) {
+          if ( ! pi.status().isToBeInstalled() )
+            continue;
+          zypp::Package::constPtr package { zypp::asKind<zypp::Package>( pi ) };
+          addJob( StageJob{ package->repoInfo(), package->location(), package->repoInfo().packagesPath(), {} } );
+        }
+
+        std::vector<std::vector<StageJob>> ret;
+        ret.reserve( media.size() );
+        for ( auto & medium : media )
+          ret.push_back( std::move(medium.second) );
+        return ret;
+      }
+
+      ZyppContextRefType _ctx;
+      std::vector<zypp::SrcPackage_constPtr> _srcPackages;
+      zypp::Pathname _srcDestDir;
+    };
+  }
+
+  AsyncOpRef<expected<StagedBuild>> stageBuild( ContextRef ctx, std::vector<zypp::SrcPackage_constPtr> srcPackages, zypp::Pathname srcDestDir )
+  {
+    return SimpleExecutor<StageBuildLogic, AsyncOp<expected<StagedBuild>>>::run( std::move(ctx), std::move(srcPackages), std::move(srcDestDir) );
+  }
+
+  expected<StagedBuild> stageBuild( SyncContextRef ctx, std::vector<zypp::SrcPackage_constPtr> srcPackages, zypp::Pathname srcDestDir )
+  {
+    return SimpleExecutor<StageBuildLogic, SyncOp<expected<StagedBuild>>>::run( std::move(ctx), std::move(srcPackages), std::move(srcDestDir) );
+  }
+
+}
@@ -0,0 +1,56 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+#ifndef ZYPP_NG_WORKFLOWS_SRCPACKAGEWF_H_INCLUDED
+#define ZYPP_NG_WORKFLOWS_SRCPACKAGEWF_H_INCLUDED
+
+#include <zypp-core/zyppng/pipelines/AsyncResult>
+#include <zypp-core/zyppng/pipelines/Expected>
+#include <zypp-core/ManagedFile.h>
+#include <zypp/ResTraits.h>
+
+#include <vector>
+
+namespace zyppng {
+
+  ZYPP_FWD_DECL_TYPE_WITH_REFS (Context);
+  ZYPP_FWD_DECL_TYPE_WITH_REFS (SyncContext);
+
+  namespace SrcPackageWorkflow {
+
+    /*!
+     * The files provided by \ref stageBuild.
+     */
+    struct StagedBuild
+    {
+      std::vector<zypp::ManagedFile> _srcPackages;    ///< the source packages, in the order they were requested
+      std::vector<zypp::ManagedFile> _buildRequires;  ///< the binary packages the resolver selected to build them
+    };
+
+    /*!
+     * Prepare building a batch of source packages.
+     *
+     * The build requirements of all \a srcPackages are added to the resolver (each distinct
+     * capability once) and the pool is solved. The source packages are provided to \a srcDestDir,
+     * the binary packages selected for installation to their repositories package cache,
+     * where the following commit will pick them up. Packages shared by several builds are
+     * provided only once.
+     *
+     * Each repository medium is attached once. In the async version all media and files
+     * are provided in parallel.
+     *
+     * \note The resolver state is kept, so the caller can commit the staged build requirements.
+     * If the build requirements can not be resolved, the requirements added to the resolver are removed again.
+     */
+    AsyncOpRef<expected<StagedBuild>> stageBuild( ContextRef ctx, std::vector<zypp::SrcPackage_constPtr> srcPackages, zypp::Pathname srcDestDir );
+    expected<StagedBuild> stageBuild( SyncContextRef ctx, std::vector<zypp::SrcPackage_constPtr> srcPackages, zypp::Pathname srcDestDir );
+
+  }
+}
+
+#endif // ZYPP_NG_WORKFLOWS_SRCPACKAGEWF_H_INCLUDED
@@ -16,6 +16,7 @@
 #include <zypp-core/base/InputStream>
 #include <zypp/base/IOStream.h>
 #include <zypp/base/Logger.h>
+#include <zypp/base/StringV.h>
 #include <zypp-core/parser/ParseException>
 
 #include <zypp/parser/HistoryLogReader.h>
@@ -59,23 +60,35 @@ namespace zypp
     Pathname _filename;
     Options  _options;
     ProcessData _callback;
-    std::set<std::string> _actionfilter;
+    std::set<std::string,std::less<>> _actionfilter;
   };
 
   bool HistoryLogReader::Impl::parseLine( const std::string & line_r, unsigned lineNr_r )
   {
-    // parse into fields
+    // parse into fields (stop early if the action is filtered)
     HistoryLogData::FieldVector fields;
-    str::splitEscaped( line_r, std::back_inserter(fields), "|", true );
+    bool filtered = false;
+    strv::splitEscaped( line_r, "|", true, [&]( std::string_view word_r, unsigned idx_r ) {
+      if ( idx_r == 1 )
+      {
+        word_r = strv::trim( word_r, str::whitespace );	// for whatever reason writer is padding the action field
+        if ( !_actionfilter.empty() && !_actionfilter.count( word_r ) )
+        {
+          filtered = true;
+          return false;
+        }
+      }
+      fields.emplace_back( word_r );
+      return true;
+    } );
+
+    if ( filtered )
+      return true;
 
     if ( fields.size() < 2 ) {
       WAR << "Ignore invalid history log entry on line #" << lineNr_r << " '"<< line_r << "'" << endl;
       return true;	// At least an action field[1] is needed!
     }
-    fields[1] = str::trim( std::move(fields[1]) );	// for whatever reason writer is padding the action field
-
-    if ( !_actionfilter.empty() && !_actionfilter.count( fields[1] ) )
-      return true;
 
     // move into data class
     HistoryLogData::Ptr data;
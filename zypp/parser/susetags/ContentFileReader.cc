@@ -14,6 +14,7 @@
 
 #include <zypp/base/LogTools.h>
 #include <zypp/base/String.h>
+#include <zypp-core/base/StringV.h>
 #include <zypp/base/IOStream.h>
 #include <zypp-core/base/UserRequestException>
 #include <zypp-core/parser/ParseException>
@@ -65,13 +66,15 @@ namespace zypp
           }
 
         public:
-          bool setFileCheckSum( std::map<std::string, CheckSum> & map_r, const std::string & value ) const
+          bool setFileCheckSum( std::map<std::string, CheckSum> & map_r, std::string_view value ) const
           {
             bool error = false;
-            std::vector<std::string> words;
-            if ( str::split( value, std::back_inserter( words ) ) == 3 )
+            std::string_view words[3];
+            if ( strv::split( value, [&words]( std::string_view word_r, unsigned idx_r ) {
+                   if ( idx_r < 3 ) words[idx_r] = word_r;
+                 } ) == 3 )
             {
-              map_r[words[2]] = CheckSum( words[0], words[1] );
+              map_r[std::string(words[2])] = CheckSum( std::string(words[0]), std::string(words[1]) );
             }
             else
             {
@@ -194,21 +197,22 @@ namespace zypp
         for( ; line; line.next() )
         {
           // strip 1st word from line to separate tag and value.
-          std::string value( *line );
-          std::string key( str::stripFirstWord( value, /*ltrim_first*/true ) );
+          // (views into *line, valid until line.next())
+          std::string_view value( *line );
+          std::string_view key( strv::stripFirstWord( value, /*ltrim_first*/true ) );
 
-          if ( key.empty() || *key.c_str() == '#' ) // empty or comment line
+          if ( key.empty() || key[0] == '#' ) // empty or comment line
           {
             continue;
           }
 
           // strip modifier if exists
-          std::string modifier;
-          std::string::size_type pos = key.rfind( '.' );
-          if ( pos != std::string::npos )
+          std::string_view modifier;
+          std::string_view::size_type pos = key.rfind( '.' );
+          if ( pos != std::string_view::npos )
           {
             modifier = key.substr( pos+1 );
-            key.erase( pos );
+            key = key.substr( 0, pos );
           }
 
           //
@@ -216,11 +220,11 @@ namespace zypp
           //
           else if ( key == "DESCRDIR" )
           {
-            _pimpl->repoindex().descrdir = value;
+            _pimpl->repoindex().descrdir = std::string(value);
           }
           else if ( key == "DATADIR" )
           {
-            _pimpl->repoindex().datadir = value;
+            _pimpl->repoindex().datadir = std::string(value);
           }
           else if ( key == "KEY" )
           {
@@ -0,0 +1,265 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+/** \file	zypp/pool/StatusTracker.cc
+ *
+*/
+#include <iostream>
+
+#include <zypp/pool/StatusTracker.h>
+
+///////////////////////////////////////////////////////////////////
+namespace zypp
+{
+  ///////////////////////////////////////////////////////////////////
+  namespace resstatus
+  {
+    void statusChanging( const ResStatus & status_r, bit::BitField<uint16_t> newVal_r )
+    { pool::StatusTracker::instance().statusChanging( status_r, newVal_r ); }
+
+    bool trackAllChanges = false;
+  } // namespace resstatus
+  ///////////////////////////////////////////////////////////////////
+
+  ///////////////////////////////////////////////////////////////////
+  namespace pool
+  {
+    namespace
+    {
+      /** ResStatus::transacts on a plain bitfield. */
+      inline bool transacts( ResStatus::BitFieldType bits_r )
+      { return bits_r.isEqual<ResStatus::TransactField>( ResStatus::TRANSACT ); }
+    } // namespace
+
+    StatusTracker & StatusTracker::instance()
+    {
+      static StatusTracker *const _instance = new StatusTracker;	// never destructed
+      return *_instance;
+    }
+
+    void StatusTracker::add( const ResStatus & status_r, const sat::Solvable & solv_r )
+    {
+      const Owner & owner { _owner[&status_r] = Owner{ solv_r.id(), solv_r.kind() } };
+      if ( status_r.transacts() )
+        _transacting[owner._kind].insert( Entry( owner._id, &status_r ) );
+    }
+
+    void StatusTracker::remove( const ResStatus & status_r )
+    {
+      auto it { _owner.find( &status_r ) };
+      if ( it == _owner.end() )
+        return;
+      auto kit { _transacting.find( it->second._kind ) };
+      if ( kit != _transacting.end() )
+        kit->second.erase( Entry( it->second._id, &status_r ) );
+      auto forget = [&]( SaveLevel & level_r ) {
+        auto sit { level_r._saved.find( it->second._kind ) };
+        if ( sit != level_r._saved.end() )
+          sit->second.erase( &status_r );
+      };
+      forget( _base );
+      for ( auto & [id,level] : _pushed )
+        forget( level );
+      _owner.erase( it );
+    }
+
+    void StatusTracker::statusChanging( const ResStatus & status_r, ResStatus::BitFieldType newVal_r )
+    {
+      const bool transactChange { transacts( status_r._bitfield ) != transacts( newVal_r ) };
+      if ( ! ( transactChange || resstatus::trackAllChanges ) )
+        return;	// nothing to track
+
+      auto it { _owner.find( &status_r ) };
+      if ( it == _owner.end() )
+        return;	// not owned by a PoolItem
+      const Owner & owner { it->second };
+
+      // Changes done by restoring one level are recorded by the others.
+      auto save = [&]( SaveLevel & level_r ) {
+        if ( level_r.saving( owner._kind ) )
+          level_r._saved[owner._kind].emplace( &status_r, status_r._bitfield );	// keeps the first (saved) value
+      };
+      save( _base );
+      for ( auto & [id,level] : _pushed )
+        save( level );
+
+      if ( transactChange )
+      {
+        const Entry entry( owner._id, &status_r );
+        if ( transacts( newVal_r ) )
+          _transacting[owner._kind].insert( entry );
+        else
+        {
+          auto kit { _transacting.find( owner._kind ) };
+          if ( kit != _transacting.end() )
+            kit->second.erase( entry );
+        }
+      }
+    }
+
+    const StatusTracker::EntrySet & StatusTracker::transacting( const ResKind & kind_r ) const
+    {
+      static const EntrySet _empty;
+      auto kit { _transacting.find( kind_r ) };
+      return kit != _transacting.end() ? kit->second : _empty;
+    }
+
+    void StatusTracker::saveState( const ResKind & kind_r )
+    {
+      saveState( _base, kind_r );
+      updateTrackAllChanges();
+    }
+
+    void StatusTracker::discardState( const ResKind & kind_r )
+    {
+      discardState( _base, kind_r );
+      updateTrackAllChanges();
+    }
+
+    void StatusTracker::restoreState( const ResKind & kind_r )
+    { restoreState( _base, kind_r ); }
+
+    bool StatusTracker::diffState( const ResKind & kind_r ) const
+    { return diffState( _base, kind_r ); }
+
+    unsigned StatusTracker::pushState( const ResKind & kind_r )
+    {
+      unsigned id { ++_lastPushed };
+      saveState( _pushed[id], kind_r );
+      updateTrackAllChanges();
+      return id;
+    }
+
+    void StatusTracker::popState( unsigned id_r, bool restore_r )
+    {
+      auto it { _pushed.find( id_r ) };
+      if ( it == _pushed.end() )
+        return;
+      if ( restore_r )
+        restoreState( it->second, ResKind() );
+      _pushed.erase( it );
+      updateTrackAllChanges();
+    }
+
+    void StatusTracker::updateTrackAllChanges() const
+    { resstatus::trackAllChanges = _base.active() || ! _pushed.empty(); }
+
+    void StatusTracker::saveState( SaveLevel & level_r, const ResKind & kind_r )
+    {
+      if ( kind_r )
+      {
+        level_r._saved[kind_r].clear();
+        level_r._kinds.insert( kind_r );
+      }
+      else
+      {
+        level_r._saved.clear();
+        level_r._kinds.clear();	// covered by _all
+        level_r._all = true;
+      }
+    }
+
+    void StatusTracker::discardState( SaveLevel & level_r, const ResKind & kind_r )
+    {
+      if ( kind_r )
+      {
+        level_r._kinds.erase( kind_r );
+        if ( ! level_r._all )
+          level_r._saved.erase( kind_r );
+      }
+      else
+      {
+        level_r._saved.clear();
+        level_r._kinds.clear();
+        level_r._all = false;
+      }
+    }
+
+    void StatusTracker::restoreState( SaveLevel & level_r, const ResKind & kind_r )
+    {
+      if ( kind_r )
+      {
+        auto sit { level_r._saved.find( kind_r ) };
+        if ( sit != level_r._saved.end() )
+          restoreState( sit->second );
+      }
+      else
+      {
+        for ( auto & [kind,saved] : level_r._saved )
+          restoreState( saved );
+      }
+    }
+
+    void StatusTracker::restoreState( SavedMap & saved_r )
+    {
+      // The saved values stay valid, the map just lists the items changed since.
+      // Restoring reports the changes, but items already in saved_r are not added
+      // again, so iterating is safe.
+      for ( const auto & [status,bits] : saved_r )
+        const_cast<ResStatus*>(status)->bitfieldAssign( bits );
+      saved_r.clear();
+    }
+
+    bool StatusTracker::diffState( const SaveLevel & level_r, const ResKind & kind_r )
+    {
+      if ( kind_r )
+      {
+        auto sit { level_r._saved.find( kind_r ) };
+        return sit != level_r._saved.end() && diffState( sit->second );
+      }
+      for ( const auto & [kind,saved] : level_r._saved )
+      {
+        if ( diffState( saved ) )
+          return true;
+      }
+      return false;
+    }
+
+    bool StatusTracker::diffState( const SavedMap & saved_r )
+    {
+      // Same criteria as PoolItem::sameState
+      for ( const auto & [statusp,bits] : saved_r )
+      {
+        const ResStatus & status { *statusp };
+        ResStatus saved;
+        saved._bitfield = bits;
+
+        if ( status == saved )
+          continue;
+        if ( status.getTransactValue() != saved.getTransactValue()
+             && ( ! status.isBySolver() // ignore solver state changes
+                  // removing a user lock also goes to bySolver
+                  || saved.getTransactValue() == ResStatus::LOCKED ) )
+          return true;
+        if ( status.isLicenceConfirmed() != saved.isLicenceConfirmed() )
+          return true;
+      }
+      return false;
+    }
+
+    std::ostream & operator<<( std::ostream & str, const StatusTracker & obj )
+    {
+      str << "StatusTracker(" << obj._owner.size() << ") {";
+      for ( const auto & [kind,entries] : obj._transacting )
+      {
+        if ( ! entries.empty() )
+          str << " " << kind << ":" << entries.size();
+      }
+      str << " } saved {";
+      for ( const auto & [kind,saved] : obj._base._saved )
+      {
+        if ( ! saved.empty() )
+          str << " " << kind << ":" << saved.size();
+      }
+      return str << " } pushed " << obj._pushed.size();
+    }
+
+  } // namespace pool
+  ///////////////////////////////////////////////////////////////////
+} // namespace zypp
+///////////////////////////////////////////////////////////////////
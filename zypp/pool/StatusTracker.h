@@ -0,0 +1,163 @@
+/*---------------------------------------------------------------------\
+|                          ____ _   __ __ ___                          |
+|                         |__  / \ / / . \ . \                         |
+|                           / / \ V /|  _/  _/                         |
+|                          / /__ | | | | | |                           |
+|                         /_____||_| |_| |_|                           |
+|                                                                      |
+\---------------------------------------------------------------------*/
+/** \file	zypp/pool/StatusTracker.h
+ *
+*/
+#ifndef ZYPP_POOL_STATUSTRACKER_H
+#define ZYPP_POOL_STATUSTRACKER_H
+
+#include <iosfwd>
+#include <map>
+#include <set>
+#include <unordered_map>
+
+#include <zypp/ResKind.h>
+#include <zypp/ResStatus.h>
+#include <zypp/sat/Solvable.h>
+
+///////////////////////////////////////////////////////////////////
+namespace zypp
+{
+  ///////////////////////////////////////////////////////////////////
+  namespace pool
+  {
+    ///////////////////////////////////////////////////////////////////
+    /// \class StatusTracker
+    /// \brief Tracks the changes of the pool items \ref ResStatus.
+    ///
+    /// Each \ref PoolItem registers the \ref ResStatus it owns. A
+    /// \ref ResStatus reports each change before it happens. Reports about
+    /// unregistered \ref ResStatus objects (copies, backups) are ignored.
+    ///
+    /// The tracker knows which of the registered items are set to transact,
+    /// grouped by kind. It also maintains copy-on-write snapshots of the
+    /// status values (see \ref saveState).
+    ///
+    /// An item is identified by its solvable id and the address of its
+    /// \ref ResStatus, so an outdated \ref PoolItem someone still holds does
+    /// not collide with a new item reusing the same id.
+    ///
+    /// \note Never destructed, as PoolItems may outlive any static.
+    ///////////////////////////////////////////////////////////////////
+    class StatusTracker
+    {
+      friend std::ostream & operator<<( std::ostream & str, const StatusTracker & obj );
+
+    public:
+      using IdType   = sat::detail::SolvableIdType;
+      using Entry    = std::pair<IdType,const ResStatus *>;
+      using EntrySet = std::set<Entry>;
+      using KindMap  = std::map<ResKind,EntrySet>;
+
+      /** Singleton */
+      static StatusTracker & instance();
+
+    public:
+      /** Register \a status_r as the status owned by \a solv_r. */
+      void add( const ResStatus & status_r, const sat::Solvable & solv_r );
+
+      /** Forget about \a status_r. */
+      void remove( const ResStatus & status_r );
+
+      /** \a status_r is about to change to \a newVal_r. */
+      void statusChanging( const ResStatus & status_r, ResStatus::BitFieldType newVal_r );
+
+    public:
+      /** Entries set to transact per kind (kinds without entries may be missing). */
+      const KindMap & transacting() const
+      { return _transacting; }
+
+      /** Entries of \a kind_r set to transact. */
+      const EntrySet & transacting( const ResKind & kind_r ) const;
+
+    public:
+      /** \name Copy-on-write status snapshots.
+       *
+       * Saving the state of a kind (or of all kinds if \a kind_r is empty)
+       * is O(1). Afterwards the first change of an items status remembers
+       * the saved value. Restoring and comparing touches just these items.
+       * \see \ref ResPoolProxy::saveState
+       */
+      //@{
+      void saveState( const ResKind & kind_r = ResKind() );
+      void restoreState( const ResKind & kind_r = ResKind() );
+      bool diffState( const ResKind & kind_r = ResKind() ) const;
+      /** End saving the state (of \a kind_r) and forget the saved values.
+       * Unless a state is saved, only changes of the transact state need
+       * to be tracked.
+       */
+      void discardState( const ResKind & kind_r = ResKind() );
+      //@}
+
+      /** \name Nested status snapshots.
+       *
+       * Each \ref pushState starts a level of its own, independent from
+       * the one used by \ref saveState and from the other pushed levels.
+       * So a \ref ResPoolProxy::ScopedSaveState can be nested inside any
+       * other save without affecting it.
+       */
+      //@{
+      /** Start a new level saving \a kind_r (or all kinds if empty). */
+      unsigned pushState( const ResKind & kind_r = ResKind() );
+      /** End the level \a id_r, restoring its saved state if \a restore_r. */
+      void popState( unsigned id_r, bool restore_r );
+      //@}
+
+    private:
+      StatusTracker() {}
+
+      struct Owner
+      {
+        IdType  _id;
+        ResKind _kind;
+      };
+      using SavedMap = std::unordered_map<const ResStatus *,ResStatus::BitFieldType>;
+
+      /** A saved state. */
+      struct SaveLevel
+      {
+        bool _all = false;			///< saving all kinds
+        std::set<ResKind> _kinds;		///< saving these kinds
+        std::map<ResKind,SavedMap> _saved;	///< original values of the changed items per kind
+
+        /** Whether changes of \a kind_r are to be saved. */
+        bool saving( const ResKind & kind_r ) const
+        { return _all || _kinds.count( kind_r ); }
+
+        /** Whether anything is to be saved. */
+        bool active() const
+        { return _all || ! _kinds.empty(); }
+      };
+
+      static void saveState( SaveLevel & level_r, const ResKind & kind_r );
+      static void discardState( SaveLevel & level_r, const ResKind & kind_r );
+      static void restoreState( SaveLevel & level_r, const ResKind & kind_r );
+      static void restoreState( SavedMap & saved_r );
+      static bool diffState( const SaveLevel & level_r, const ResKind & kind_r );
+      static bool diffState( const SavedMap & saved_r );
+
+      /** Track any change as long as some level is saving. */
+      void updateTrackAllChanges() const;
+
+      std::unordered_map<const ResStatus *,Owner> _owner;
+      KindMap _transacting;
+
+      SaveLevel _base;				///< saveState
+      std::map<unsigned,SaveLevel> _pushed;	///< pushState levels by id
+      unsigned _lastPushed = 0;
+    };
+
+    /** \relates StatusTracker Stream output */
+    std::ostream & operator<<( std::ostream & str, const StatusTracker & obj );
+
+  } // namespace pool
+  ///////////////////////////////////////////////////////////////////
+} // namespace zypp
+///////////////////////////////////////////////////////////////////
+#endif // ZYPP_POOL_STATUSTRACKER_H
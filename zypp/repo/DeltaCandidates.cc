@@ -12,8 +12,12 @@ extern "C"
 }
 
 #include <iostream>
+#include <mutex>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #include <zypp/base/Logger.h>
+#include <zypp/base/SerialNumber.h>
 #include <zypp/Repository.h>
 #include <zypp/repo/DeltaCandidates.h>
 #include <zypp/sat/Pool.h>
@@ -28,6 +32,75 @@ namespace zypp
   ///////////////////////////////////////////////////////////////////
   namespace repo
   { /////////////////////////////////////////////////////////////////
+    namespace
+    {
+      /** The (name, evr, arch) of a delta's target package. */
+      struct DeltaKey
+      {
+        sat::detail::IdType _name;
+        sat::detail::IdType _evr;
+        sat::detail::IdType _arch;
+
+        bool operator==( const DeltaKey & rhs ) const
+        { return _name == rhs._name && _evr == rhs._evr && _arch == rhs._arch; }
+      };
+
+      struct DeltaKeyHash
+      {
+        std::size_t operator()( const DeltaKey & key_r ) const
+        { return ( std::size_t(key_r._name) * 31 + std::size_t(key_r._evr) ) * 31 + std::size_t(key_r._arch); }
+      };
+
+      ///////////////////////////////////////////////////////////////////
+      /// \class RepoDeltaIndex
+      /// \brief All DeltaRpms of a repository indexed by their target package.
+      ///
+      /// Parsing the repositoryDeltaInfo of a large repo for each package
+      /// to download is quadratic. The index is built once and is valid as
+      /// long as the pools content does not change.
+      ///////////////////////////////////////////////////////////////////
+      struct RepoDeltaIndex
+      {
+        using Ptr = std::shared_ptr<const RepoDeltaIndex>;
+
+        explicit RepoDeltaIndex( const Repository & repo_r )
+        {
+          sat::LookupRepoAttr q( sat::SolvAttr::repositoryDeltaInfo, repo_r );
+          for_( it, q.begin(), q.end() )
+          {
+            DeltaKey key { it.subFind( sat::SolvAttr(DELTA_PACKAGE_NAME) ).id(),
+                           it.subFind( sat::SolvAttr(DELTA_PACKAGE_EVR) ).id(),
+                           it.subFind( sat::SolvAttr(DELTA_PACKAGE_ARCH) ).id() };
+            _index[key].push_back( _deltas.size() );
+            _deltas.push_back( DeltaRpm( it ) );
+          }
+          DBG << "Indexed " << _deltas.size() << " deltas for " << _index.size() << " packages in " << repo_r << endl;
+        }
+
+        std::vector<DeltaRpm> _deltas;	///< in repo order
+        std::unordered_map<DeltaKey,std::vector<unsigned>,DeltaKeyHash> _index;
+      };
+
+      /** The (cached) RepoDeltaIndex for \a repo_r.
+       * Cached indices are dropped if the pools serial number changed.
+       */
+      RepoDeltaIndex::Ptr repoDeltaIndex( const Repository & repo_r )
+      {
+        static std::mutex mutex;
+        static std::unordered_map<Repository::IdType,RepoDeltaIndex::Ptr> cache;
+        static SerialNumberWatcher watcher;
+
+        std::lock_guard<std::mutex> guard( mutex );
+        if ( watcher.remember( sat::Pool::instance().serial() ) )
+          cache.clear();
+
+        RepoDeltaIndex::Ptr & ret { cache[repo_r.id()] };
+        if ( ! ret )
+          ret = std::make_shared<const RepoDeltaIndex>( repo_r );
+        return ret;
+      }
+    } // namespace
+    ///////////////////////////////////////////////////////////////////
 
     /** DeltaCandidates implementation. */
     struct DeltaCandidates::Impl
@@ -77,34 +150,71 @@ namespace zypp
     {}
 
     std::list<DeltaRpm> DeltaCandidates::deltaRpms(const Package::constPtr & package) const
+    { return deltaRpms( package, BaseFilter() ); }
+
+    std::list<DeltaRpm> DeltaCandidates::deltaRpms( const Package::constPtr & package, const BaseFilter & baseFilter_r ) const
     {
       std::list<DeltaRpm> candidates;
+      std::unordered_map<sat::detail::IdType,bool> baseOk;	// query each base edition just once
+
+      auto accept = [&]( const DeltaRpm & delta_r ) {
+        if ( ! _pimpl->pkgname.empty() && delta_r.name() != _pimpl->pkgname )
+          return;
+        if ( baseFilter_r )
+        {
+          const Edition & base { delta_r.baseversion().edition() };
+          if ( base != Edition::noedition )
+          {
+            auto it { baseOk.find( base.id() ) };
+            if ( it == baseOk.end() )
+              it = baseOk.emplace( base.id(), baseFilter_r( base ) ).first;
+            if ( ! it->second )
+              return;
+          }
+        }
+        DBG << "got delta candidate: " << delta_r << endl;
+        candidates.push_back( delta_r );
+      };
 
       DBG << "package: " << package << endl;
       for_( rit, _pimpl->repos.begin(), _pimpl->repos.end() )
       {
-        sat::LookupRepoAttr q( sat::SolvAttr::repositoryDeltaInfo, *rit );
-        for_( it, q.begin(), q.end() )
+        RepoDeltaIndex::Ptr idx { repoDeltaIndex( *rit ) };
+        if ( package )
         {
-          if ( _pimpl->pkgname.empty()
-               || it.subFind( sat::SolvAttr(DELTA_PACKAGE_NAME) ).asString() == _pimpl->pkgname )
+          auto it { idx->_index.find( DeltaKey{ package->ident().id(), package->edition().id(), package->arch().id() } ) };
+          if ( it != idx->_index.end() )
           {
-            DeltaRpm delta( it );
-            //DBG << "checking delta: " << delta << endl;
-            if ( ! package
-                   || (    package->name()    == delta.name()
-                        && package->edition() == delta.edition()
-                        && package->arch()    == delta.arch() ) )
-            {
-              DBG << "got delta candidate: " << delta << endl;
-              candidates.push_back( delta );
-            }
+            for ( unsigned pos : it->second )
+              accept( idx->_deltas[pos] );
           }
         }
+        else
+        {
+          for ( const DeltaRpm & delta : idx->_deltas )
+            accept( delta );
+        }
       }
       return candidates;
     }
 
+    bool DeltaCandidates::haveDeltaRpms( const Package::constPtr & package ) const
+    {
+      if ( ! package )
+        return false;
+      if ( ! _pimpl->pkgname.empty() && package->name() != _pimpl->pkgname )
+        return false;
+
+      const DeltaKey key { package->ident().id(), package->edition().id(), package->arch().id() };
+      for_( rit, _pimpl->repos.begin(), _pimpl->repos.end() )
+      {
+        RepoDeltaIndex::Ptr idx { repoDeltaIndex( *rit ) };
+        if ( idx->_index.count( key ) )
+          return true;
+      }
+      return false;
+    }
+
     std::ostream & operator<<( std::ostream & str, const DeltaCandidates & obj )
     {
       return str << *obj._pimpl;
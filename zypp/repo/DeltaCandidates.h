@@ -56,8 +56,27 @@ namespace zypp
       /** Dtor */
       ~DeltaCandidates();
 
+      /** The deltas building \a package (all deltas if \a package is \c nullptr).
+       * Each repositories deltas are indexed once by their target package,
+       * so the lookup does not need to scan the repositories delta info.
+       */
       std::list<packagedelta::DeltaRpm> deltaRpms(const Package::constPtr & package) const;
 
+      /** Predicate telling whether a deltas base version is available (e.g. installed). */
+      using BaseFilter = function<bool(const Edition &)>;
+
+      /** As \ref deltaRpms(const Package::constPtr &) but only deltas whose
+       * base version is accepted by \a baseFilter_r. Deltas without base
+       * version are always returned. The filter is asked just once per edition.
+       */
+      std::list<packagedelta::DeltaRpm> deltaRpms( const Package::constPtr & package, const BaseFilter & baseFilter_r ) const;
+
+      /** Whether there are any deltas building \a package (cheap index lookup).
+       * Use it to avoid more expensive checks (like querying the rpm database)
+       * if there is nothing to do anyway.
+       */
+      bool haveDeltaRpms( const Package::constPtr & package ) const;
+
     private:
       /** Pointer to implementation */
       RWCOW_pointer<Impl> _pimpl;
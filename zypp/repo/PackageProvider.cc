@@ -568,14 +568,17 @@ namespace zypp
     {
       // check whether to process patch/delta rpms
       // FIXME we only check the first url for now.
-      if ( ZConfig::instance().download_use_deltarpm()
-        && ( _package->repoInfo().url().schemeIsDownloading() || ZConfig::instance().download_use_deltarpm_always() ) )
+      const ZConfig::SnapshotPtr cfg { ZConfig::instance().snapshot() };
+      if ( cfg->download_use_deltarpm
+        && ( _package->repoInfo().url().schemeIsDownloading() || cfg->download_use_deltarpm_always ) )
       {
-        std::list<DeltaRpm> deltaRpms;
-        _deltas.deltaRpms( _package ).swap( deltaRpms );
-
-        if ( ! deltaRpms.empty() && queryInstalled() && applydeltarpm::haveApplydeltarpm() )
+        // query the rpm database only if there are deltas at all
+        if ( _deltas.haveDeltaRpms( _package ) && queryInstalled() && applydeltarpm::haveApplydeltarpm() )
         {
+          // only deltas applicable to an installed base version
+          std::list<DeltaRpm> deltaRpms;
+          _deltas.deltaRpms( _package, [this]( const Edition & ed_r ) { return queryInstalled( ed_r ); } ).swap( deltaRpms );
+
           for_( it, deltaRpms.begin(), deltaRpms.end())
           {
             DBG << "tryDelta " << *it << endl;
@@ -592,10 +595,7 @@ namespace zypp
 
     ManagedFile RpmPackageProvider::tryDelta( const DeltaRpm & delta_r ) const
     {
-      if ( delta_r.baseversion().edition() != Edition::noedition
-           && ! queryInstalled( delta_r.baseversion().edition() ) )
-        return ManagedFile();
-
+      // base version was checked by DeltaCandidates
       if ( ! applydeltarpm::quickcheck( delta_r.baseversion().sequenceinfo() ) )
         return ManagedFile();
 
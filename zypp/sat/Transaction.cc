@@ -14,11 +14,13 @@ extern "C"
 #include <solv/solver.h>
 }
 #include <iostream>
+#include <map>
+#include <optional>
+#include <vector>
 #include <zypp/base/LogTools.h>
 #include <zypp/base/SerialNumber.h>
 #include <zypp-core/base/DefaultIntegral>
 #include <zypp/base/NonCopyable.h>
-#include <zypp/base/Hash.h>
 
 #include <zypp/sat/detail/PoolImpl.h>
 #include <zypp/sat/Transaction.h>
@@ -45,6 +47,9 @@ namespace zypp
      * stepType. Thats why some information (stepType, NVRA) is be stored
      * for post mortem access (i.e. tell after commit which NVRA were deleted).
      *
+     * Per solvable data is kept in dense arrays indexed by the solvable id,
+     * per step data (stepType, kind, media) is computed once when loading.
+     * Commit iterates the steps several times, so each step lookup is O(1).
      */
     struct Transaction::Impl : protected detail::PoolMember
                              , private base::NonCopyable
@@ -52,9 +57,6 @@ namespace zypp
       friend std::ostream & operator<<( std::ostream & str, const Impl & obj );
 
       public:
-        using set_type = std::unordered_set<detail::IdType>;
-        using map_type = std::unordered_map<detail::IdType, detail::IdType>;
-
         struct PostMortem
         {
           PostMortem()
@@ -69,7 +71,22 @@ namespace zypp
           Edition  _edition;
           Arch     _arch;
         };
-        using pmmap_type = std::unordered_map<detail::IdType, PostMortem>;
+
+        /** Data computed once per step. */
+        struct StepInfo
+        {
+          StepType   _type = TRANSACTION_IGNORE;
+          unsigned   _mediaNr = 0;
+          PostMortem _pm;		// @System solvables only
+        };
+
+        /** Steps partitioned by action, in transaction order. */
+        struct Partitions
+        {
+          std::vector<detail::IdType> _install;
+          std::vector<detail::IdType> _erase;
+          std::map<unsigned, std::vector<detail::IdType>> _media;	// install steps by media number
+        };
 
       public:
         Impl()
@@ -99,6 +116,13 @@ namespace zypp
           ::solver_calculate_noobsmap( myPool().getPool(), noobsq, noobsmap );
           _trans = ::transaction_create_decisionq( myPool().getPool(), decisionq, noobsmap );
 
+          const size_t idLimit = myPool().getPool()->nsolvables;
+          _buddy.resize( idLimit, 0 );
+          _stage.resize( idLimit, STEP_TODO );
+          _info.resize( idLimit, 0 );
+          _pos.resize( idLimit, 0 );
+          _stepInfo.reserve( _trans->steps.count );
+
           // NOTE: package/product buddies share the same ResStatus
           // so we also link the buddies stepStages. This assumes
           // only one buddy is acting during commit (package is installed,
@@ -106,26 +130,26 @@ namespace zypp
           for_( it, _trans->steps.elements, _trans->steps.elements + _trans->steps.count )
           {
             sat::Solvable solv( *it );
+            StepInfo info;
+            info._type = computeStepType( solv );
             // buddy list:
             if ( ! solv.isKind<Package>() )
             {
               PoolItem pi( solv );
               if ( pi.buddy() )
               {
-                _linkMap[*it] = pi.buddy().id();
+                _buddy[*it] = pi.buddy().id();
               }
             }
             if ( solv.isSystem() )
-            {
-              // to delete list:
-              if ( stepType( solv ) == TRANSACTION_ERASE )
-              {
-                _systemErase.insert( *it );
-              }
-              // post mortem data
-              _pmMap[*it] = solv;
-            }
+              info._pm = solv;	// post mortem data
+            else if ( info._type != TRANSACTION_IGNORE )
+              info._mediaNr = solv.mediaNr();
+
+            _stepInfo.push_back( std::move(info) );
+            _info[*it] = _stepInfo.size();
           }
+          updatePositions();
         }
 
         ~Impl()
@@ -163,6 +187,8 @@ namespace zypp
           {
             ::transaction_order( _trans, 0 );
             _ordered = true;
+            updatePositions();
+            _partitions.reset();
           }
           return true;
         }
@@ -188,6 +214,21 @@ namespace zypp
         iterator find(const RW_pointer<Transaction::Impl> & self_r, const sat::Solvable & solv_r )
         { detail::IdType * it( _find( solv_r ) ); return it ? iterator( self_r, it ) : end( self_r ); }
 
+      public:
+        Iterable<const_iterator> installSteps( const RW_pointer<Transaction::Impl> & self_r ) const
+        { return makeIterable( self_r, partitions()._install ); }
+
+        Iterable<const_iterator> eraseSteps( const RW_pointer<Transaction::Impl> & self_r ) const
+        { return makeIterable( self_r, partitions()._erase ); }
+
+        Iterable<const_iterator> mediaSteps( const RW_pointer<Transaction::Impl> & self_r, unsigned mediaNr_r ) const
+        {
+          static const std::vector<detail::IdType> _none;
+          const auto & media( partitions()._media );
+          auto it( media.find( mediaNr_r ) );
+          return makeIterable( self_r, it == media.end() ? _none : it->second );
+        }
+
       public:
         int installedResult( Queue & result_r ) const
         { return ::transaction_installedresult( _trans, result_r ); }
@@ -201,81 +242,107 @@ namespace zypp
       public:
         StepType stepType( Solvable solv_r ) const
         {
-          if ( ! solv_r )
-          {
-            // post mortem @System solvable
-            return isIn( _systemErase, solv_r.id() ) ? TRANSACTION_ERASE : TRANSACTION_IGNORE;
-          }
-
-          switch( ::transaction_type( _trans, solv_r.id(), SOLVER_TRANSACTION_RPM_ONLY ) )
-          {
-            case SOLVER_TRANSACTION_ERASE: return TRANSACTION_ERASE; break;
-            case SOLVER_TRANSACTION_INSTALL: return TRANSACTION_INSTALL; break;
-            case SOLVER_TRANSACTION_MULTIINSTALL: return TRANSACTION_MULTIINSTALL; break;
-          }
-          return TRANSACTION_IGNORE;
+          if ( const StepInfo * info = stepInfo( solv_r.id() ) )
+            return info->_type;
+          // not a step; post mortem @System solvables are always steps
+          return solv_r ? computeStepType( solv_r ) : TRANSACTION_IGNORE;
         }
 
         StepStage stepStage( Solvable solv_r ) const
-        { return stepStage( resolve( solv_r ) ); }
+        {
+          detail::IdType sid( resolve( solv_r ) );
+          return size_t(sid) < _stage.size() ? StepStage( _stage[sid] ) : STEP_TODO;
+        }
 
         void stepStage( Solvable solv_r, StepStage newval_r )
-        { stepStage( resolve( solv_r ), newval_r ); }
+        {
+          detail::IdType sid( resolve( solv_r ) );
+          if ( size_t(sid) >= _stage.size() )
+            _stage.resize( sid + 1, STEP_TODO );
+          _stage[sid] = newval_r;
+        }
 
         const PostMortem & pmdata( Solvable solv_r ) const
         {
           static PostMortem _none;
-          pmmap_type::const_iterator it( _pmMap.find( solv_r.id() ) );
-          return( it == _pmMap.end() ? _none : it->second );
+          const StepInfo * info( stepInfo( solv_r.id() ) );
+          return( info ? info->_pm : _none );
         }
 
       private:
-        detail::IdType resolve( const Solvable & solv_r ) const
+        StepType computeStepType( Solvable solv_r ) const
         {
-          map_type::const_iterator res( _linkMap.find( solv_r.id() ) );
-          return( res == _linkMap.end() ? solv_r.id() : res->second );
+          switch( ::transaction_type( _trans, solv_r.id(), SOLVER_TRANSACTION_RPM_ONLY ) )
+          {
+            case SOLVER_TRANSACTION_ERASE: return TRANSACTION_ERASE; break;
+            case SOLVER_TRANSACTION_INSTALL: return TRANSACTION_INSTALL; break;
+            case SOLVER_TRANSACTION_MULTIINSTALL: return TRANSACTION_MULTIINSTALL; break;
+          }
+          return TRANSACTION_IGNORE;
         }
 
-        bool isIn( const set_type & set_r, detail::IdType sid_r ) const
-        { return( set_r.find( sid_r ) != set_r.end() ); }
+        const StepInfo * stepInfo( detail::IdType sid_r ) const
+        {
+          if ( sid_r < 0 || size_t(sid_r) >= _info.size() || ! _info[sid_r] )
+            return nullptr;
+          return &_stepInfo[_info[sid_r]-1];
+        }
 
-        StepStage stepStage( detail::IdType sid_r ) const
+        detail::IdType resolve( const Solvable & solv_r ) const
         {
-          if ( isIn( _doneSet, sid_r ) )
-            return STEP_DONE;
-          if ( isIn( _errSet, sid_r ) )
-            return STEP_ERROR;
-          return STEP_TODO;
+          detail::IdType sid( solv_r.id() );
+          return( size_t(sid) < _buddy.size() && _buddy[sid] ? _buddy[sid] : sid );
         }
 
-        void stepStage( detail::IdType sid_r, StepStage newval_r )
+        /** Remember each steps position in the current order. */
+        void updatePositions()
         {
-          StepStage stage( stepStage( sid_r ) );
-          if ( stage != newval_r )
+          std::fill( _pos.begin(), _pos.end(), 0 );
+          for ( unsigned i = 0; i < unsigned(_trans->steps.count); ++i )
           {
-            // reset old stage
-            if ( stage != STEP_TODO )
-            {
-              (stage == STEP_DONE ? _doneSet : _errSet).erase( sid_r );
-            }
-            if ( newval_r != STEP_TODO )
-            {
-              (newval_r == STEP_DONE ? _doneSet : _errSet).insert( sid_r );
-            }
+            detail::IdType sid( _trans->steps.elements[i] );
+            if ( size_t(sid) < _pos.size() )
+              _pos[sid] = i + 1;
           }
         }
 
-      private:
-        detail::IdType * _find( const sat::Solvable & solv_r ) const
+        const Partitions & partitions() const
         {
-          if ( solv_r && _trans->steps.elements )
+          if ( ! _partitions )
           {
+            Partitions & parts( _partitions.emplace() );
             for_( it, _trans->steps.elements, _trans->steps.elements + _trans->steps.count )
             {
-              if ( *it == detail::IdType(solv_r.id()) )
-                return it;
+              const StepInfo * info( stepInfo( *it ) );
+              if ( ! info )
+                continue;
+              switch ( info->_type )
+              {
+                case TRANSACTION_INSTALL:
+                case TRANSACTION_MULTIINSTALL:
+                  parts._install.push_back( *it );
+                  parts._media[info->_mediaNr].push_back( *it );
+                  break;
+                case TRANSACTION_ERASE:
+                  parts._erase.push_back( *it );
+                  break;
+                case TRANSACTION_IGNORE:
+                  break;
+              }
             }
           }
+          return *_partitions;
+        }
+
+        static Iterable<const_iterator> makeIterable( const RW_pointer<Transaction::Impl> & self_r, const std::vector<detail::IdType> & steps_r )
+        { return zypp::makeIterable( const_iterator( self_r, steps_r.data() ), const_iterator( self_r, steps_r.data() + steps_r.size() ) ); }
+
+      private:
+        detail::IdType * _find( const sat::Solvable & solv_r ) const
+        {
+          detail::IdType sid( solv_r.id() );
+          if ( solv_r && size_t(sid) < _pos.size() && _pos[sid] )
+            return _trans->steps.elements + _pos[sid] - 1;
           return 0;
         }
 
@@ -283,12 +350,14 @@ namespace zypp
         SerialNumberWatcher _watcher;
         mutable ::Transaction * _trans;
         DefaultIntegral<bool,false> _ordered;
+        // indexed by solvable id:
+        std::vector<detail::IdType> _buddy;	// buddy to adopt buddies StepResult
+        std::vector<unsigned char>  _stage;	// StepStage
+        std::vector<unsigned>       _info;	// 1-based index into _stepInfo; 0 if not a step
+        std::vector<unsigned>       _pos;	// 1-based position in the current order; 0 if not a step
         //
-        set_type	_doneSet;
-        set_type	_errSet;
-        map_type	_linkMap;	// buddy map to adopt buddies StepResult
-        set_type	_systemErase;	// @System packages to be eased (otherse are TRANSACTION_IGNORE)
-        pmmap_type	_pmMap;		// Post mortem data of deleted @System solvables
+        std::vector<StepInfo>       _stepInfo;	// in load order; keeps stepType and post mortem data of deleted @System solvables
+        mutable std::optional<Partitions> _partitions;	// built on demand, dropped on reorder
 
         StringQueue	_autoInstalled;	// ident strings of all packages that would be auto-installed after the transaction is run.
 
@@ -354,6 +423,15 @@ namespace zypp
     Transaction::iterator Transaction::find( const sat::Solvable & solv_r )
     { return _pimpl->find( _pimpl, solv_r ); }
 
+    Iterable<Transaction::const_iterator> Transaction::installSteps() const
+    { return _pimpl->installSteps( _pimpl ); }
+
+    Iterable<Transaction::const_iterator> Transaction::eraseSteps() const
+    { return _pimpl->eraseSteps( _pimpl ); }
+
+    Iterable<Transaction::const_iterator> Transaction::mediaSteps( unsigned mediaNr_r ) const
+    { return _pimpl->mediaSteps( _pimpl, mediaNr_r ); }
+
     int Transaction::installedResult( Queue & result_r ) const
     { return _pimpl->installedResult( result_r ); }
 
@@ -169,6 +169,30 @@ namespace zypp
         Iterable<action_iterator> action( StepStages filter_r = StepStages() ) const;
         //@}
 
+      public:
+        /** \name Partitioned views of the transaction steps.
+         *
+         * The steps keep the transaction order. The partitions are computed once and
+         * are invalidated by \ref order, just like any outstanding iterator.
+         *
+         * \code
+         *    for ( const sat::Transaction::Step & step : trans.installSteps() )
+         *    {
+         *       ... // download step.satSolvable()
+         *    }
+         * \endcode
+         */
+        //@{
+        /** Steps installing an item (\ref TRANSACTION_INSTALL and \ref TRANSACTION_MULTIINSTALL). */
+        Iterable<const_iterator> installSteps() const;
+
+        /** Steps deleting an item (\ref TRANSACTION_ERASE). */
+        Iterable<const_iterator> eraseSteps() const;
+
+        /** The \ref installSteps of items on media \a mediaNr_r (\see \ref Solvable::mediaNr). */
+        Iterable<const_iterator> mediaSteps( unsigned mediaNr_r ) const;
+        //@}
+
       public:
         /** Return all packages that would be installed after the transaction is run.
          * The new packages are put at the head of the queue, the number of new
@@ -286,9 +286,8 @@ void Resolver::undo()
 {
     UndoTransact info(ResStatus::APPL_LOW);
     MIL << "*** undo ***" << endl;
-    invokeOnEach ( _pool.begin(), _pool.end(),
-                   resfilter::ByTransact( ),			// collect transacts from Pool to resolver queue
-                   std::ref(info) );
+    for ( const PoolItem & item : _pool.transacting() )	// collect transacts from Pool to resolver queue
+      info( item );
     //  Regard dependencies of the item weak onl
     _addWeak.clear();
 
@@ -340,9 +339,8 @@ bool Resolver::verifySystem()
   DBG << "Resolver::verifySystem()" << endl;
   _verifying = true;
   UndoTransact resetting (ResStatus::APPL_HIGH);
-  invokeOnEach ( _pool.begin(), _pool.end(),
-                 resfilter::ByTransact( ),			// Resetting all transcations
-                 std::ref(resetting) );
+  for ( const PoolItem & item : _pool.transacting() )	// Resetting all transcations
+    resetting( item );
   return resolvePool();
 }
 
@@ -435,6 +435,7 @@ void
 SATResolver::solverEnd()
 {
   // cleanup
+  computePendingProblems();
   if ( _satSolver )
   {
     solver_free(_satSolver);
@@ -1357,327 +1358,356 @@ SATResolver::problems ()
 {
     ResolverProblemList resolverProblems;
     if (_satSolver && solver_problem_count(_satSolver)) {
-        sat::detail::CPool *pool = _satSolver->pool;
-        int pcnt = 0;
-        Id p = 0, rp = 0, what = 0;
-        Id problem = 0, solution = 0, element = 0;
-        sat::Solvable s, sd;
-
-        CapabilitySet system_requires = SystemCheck::instance().requiredSystemCap();
-        CapabilitySet system_conflicts = SystemCheck::instance().conflictSystemCap();
-
-        MIL << "Encountered problems! Here are the solutions:\n" << endl;
-        pcnt = 1;
-        problem = 0;
+        MIL << "Encountered " << solver_problem_count(_satSolver) << " problems; solutions are computed on demand." << endl;
+        if ( ! _problemsToken )
+          _problemsToken = std::make_shared<int>( 0 );
+
+        int pcnt = 1;
+        Id problem = 0;
         while ((problem = solver_next_problem(_satSolver, problem)) != 0) {
-            MIL << "Problem " <<  pcnt++ << ":" << endl;
-            MIL << "====================================" << endl;
-            std::string detail;
-            Id ignoreId = 0;
-            std::string whatString = SATprobleminfoString (problem,detail,ignoreId);
-            MIL << whatString << endl;
-            MIL << "------------------------------------" << endl;
-            ResolverProblem_Ptr resolverProblem = new ResolverProblem (whatString, detail, SATgetCompleteProblemInfoStrings( problem ));
-            PtfPatchHint ptfPatchHint;  // bsc#1194848 hint on ptf<>patch conflicts
-            solution = 0;
-            while ((solution = solver_next_solution(_satSolver, problem, solution)) != 0) {
-                element = 0;
-                ProblemSolutionCombi *problemSolution = new ProblemSolutionCombi;
-                while ((element = solver_next_solutionelement(_satSolver, problem, solution, element, &p, &rp)) != 0) {
-                    if (p == SOLVER_SOLUTION_JOB) {
-                        /* job, rp is index into job queue */
-                        what = _jobQueue.elements[rp];
-                        switch (_jobQueue.elements[rp-1]&(SOLVER_SELECTMASK|SOLVER_JOBMASK))
-                        {
-                            case SOLVER_INSTALL | SOLVER_SOLVABLE: {
-                                s = mapSolvable (what);
-                                PoolItem poolItem = _pool.find (s);
-                                if (poolItem) {
-                                    if (pool->installed && s.get()->repo == pool->installed) {
-                                        problemSolution->addSingleAction (poolItem, REMOVE);
-                                        std::string description = str::Format(_("remove lock to allow removal of %1%") ) % s.asString();
-                                        MIL << description << endl;
-                                        problemSolution->addDescription (description);
-                                        if ( _protectPTFs && s.isPtfMaster() )
-                                          ptfPatchHint.removePtf( s, _protectPTFs ); // bsc#1203248
-                                    } else {
-                                        problemSolution->addSingleAction (poolItem, KEEP);
-                                        std::string description = str::Format(_("do not install %1%") ) % s.asString();
-                                        MIL << description << endl;
-                                        problemSolution->addDescription (description);
-                                        if ( s.isKind<Patch>() )
-                                          ptfPatchHint.notInstallPatch( s );
-                                    }
-                                } else {
-                                    ERR << "SOLVER_INSTALL_SOLVABLE: No item found for " << s.asString() << endl;
-                                }
-                            }
-                                break;
-                            case SOLVER_ERASE | SOLVER_SOLVABLE: {
-                                s = mapSolvable (what);
-                                PoolItem poolItem = _pool.find (s);
-                                if (poolItem) {
-                                    if (pool->installed && s.get()->repo == pool->installed) {
-                                        problemSolution->addSingleAction (poolItem, KEEP);
-                                        std::string description = str::Format(_("keep %1%") ) % s.asString();
-                                        MIL << description << endl;
-                                        problemSolution->addDescription (description);
-                                    } else {
-                                        problemSolution->addSingleAction (poolItem, UNLOCK);
-                                        std::string description = str::Format(_("remove lock to allow installation of %1%") ) % itemToString( poolItem );
-                                        MIL << description << endl;
-                                        problemSolution->addDescription (description);
-                                    }
-                                } else {
-                                    ERR << "SOLVER_ERASE_SOLVABLE: No item found for " << s.asString() << endl;
-                                }
-                            }
-                                break;
-                            case SOLVER_INSTALL | SOLVER_SOLVABLE_NAME:
-                                {
-                                IdString ident( what );
-                                SolverQueueItemInstall_Ptr install =
-                                    new SolverQueueItemInstall(_pool, ident.asString(), false );
-                                problemSolution->addSingleAction (install, REMOVE_SOLVE_QUEUE_ITEM);
-
-                                std::string description = str::Format(_("do not install %1%") ) % ident;
+            std::weak_ptr<void> token { _problemsToken };
+            ResolverProblem_Ptr resolverProblem = new ResolverProblem( [this,token,problem,pcnt]( ResolverProblem & problem_r ) {
+              if ( token.expired() ) {
+                ERR << "Problem " << pcnt << " was not computed before the solver was reset." << endl;
+                return;
+              }
+              computeProblem( problem_r, problem, pcnt );
+            } );
+            _pendingProblems.push_back( resolverProblem );
+            resolverProblems.push_back (resolverProblem);
+            ++pcnt;
+        }
+    }
+    return resolverProblems;
+}
+
+void SATResolver::computePendingProblems()
+{
+    // Problems still referenced outside must be computed while the solver is alive.
+    for ( const ResolverProblem_Ptr & resolverProblem : _pendingProblems ) {
+        if ( resolverProblem->refCount() > 1 )
+            resolverProblem->description();	// triggers the computation
+    }
+    _pendingProblems.clear();
+    _problemsToken.reset();
+}
+
+void SATResolver::computeProblem( ResolverProblem & resolverProblem, Id problem, int pcnt )
+{
+    sat::detail::CPool *pool = _satSolver->pool;
+    Id p = 0, rp = 0, what = 0;
+    Id solution = 0, element = 0;
+    sat::Solvable s, sd;
+
+    CapabilitySet system_requires = SystemCheck::instance().requiredSystemCap();
+    CapabilitySet system_conflicts = SystemCheck::instance().conflictSystemCap();
+
+    MIL << "Problem " <<  pcnt << ":" << endl;
+    MIL << "====================================" << endl;
+    std::string detail;
+    Id ignoreId = 0;
+    std::string whatString = SATprobleminfoString (problem,detail,ignoreId);
+    MIL << whatString << endl;
+    MIL << "------------------------------------" << endl;
+    resolverProblem.setDescription( whatString );
+    resolverProblem.setDetails( detail );
+    resolverProblem.setCompleteProblemInfo( SATgetCompleteProblemInfoStrings( problem ) );
+    PtfPatchHint ptfPatchHint;  // bsc#1194848 hint on ptf<>patch conflicts
+    solution = 0;
+    while ((solution = solver_next_solution(_satSolver, problem, solution)) != 0) {
+        element = 0;
+        ProblemSolutionCombi *problemSolution = new ProblemSolutionCombi;
+        while ((element = solver_next_solutionelement(_satSolver, problem, solution, element, &p, &rp)) != 0) {
+            if (p == SOLVER_SOLUTION_JOB) {
+                /* job, rp is index into job queue */
+                what = _jobQueue.elements[rp];
+                switch (_jobQueue.elements[rp-1]&(SOLVER_SELECTMASK|SOLVER_JOBMASK))
+                {
+                    case SOLVER_INSTALL | SOLVER_SOLVABLE: {
+                        s = mapSolvable (what);
+                        PoolItem poolItem = _pool.find (s);
+                        if (poolItem) {
+                            if (pool->installed && s.get()->repo == pool->installed) {
+                                problemSolution->addSingleAction (poolItem, REMOVE);
+                                std::string description = str::Format(_("remove lock to allow removal of %1%") ) % s.asString();
                                 MIL << description << endl;
                                 problemSolution->addDescription (description);
-                                }
-                                break;
-                            case SOLVER_ERASE | SOLVER_SOLVABLE_NAME:
-                                {
-                                // As we do not know, if this request has come from resolvePool or
-                                // resolveQueue we will have to take care for both cases.
-                                IdString ident( what );
-                                FindPackage info (problemSolution, KEEP);
-                                invokeOnEach( _pool.byIdentBegin( ident ),
-                                              _pool.byIdentEnd( ident ),
-                                              functor::chain (resfilter::ByInstalled (),			// ByInstalled
-                                                              resfilter::ByTransact ()),			// will be deinstalled
-                                              std::ref(info) );
-
-                                SolverQueueItemDelete_Ptr del =
-                                    new SolverQueueItemDelete(_pool, ident.asString(), false );
-                                problemSolution->addSingleAction (del, REMOVE_SOLVE_QUEUE_ITEM);
-
-                                std::string description = str::Format(_("keep %1%") ) % ident;
+                                if ( _protectPTFs && s.isPtfMaster() )
+                                  ptfPatchHint.removePtf( s, _protectPTFs ); // bsc#1203248
+                            } else {
+                                problemSolution->addSingleAction (poolItem, KEEP);
+                                std::string description = str::Format(_("do not install %1%") ) % s.asString();
                                 MIL << description << endl;
                                 problemSolution->addDescription (description);
-                                }
-                                break;
-                            case SOLVER_INSTALL | SOLVER_SOLVABLE_PROVIDES:
-                                {
-                                problemSolution->addSingleAction (Capability(what), REMOVE_EXTRA_REQUIRE);
-                                std::string description = "";
-
-                                // Checking if this problem solution would break your system
-                                if (system_requires.find(Capability(what)) != system_requires.end()) {
-                                    // Show a better warning
-                                    resolverProblem->setDetails( resolverProblem->description() + "\n" + resolverProblem->details() );
-                                    resolverProblem->setDescription(_("This request will break your system!"));
-                                    description = _("ignore the warning of a broken system");
-                                    description += std::string(" (requires:")+pool_dep2str(pool, what)+")";
-                                    MIL << description << endl;
-                                    problemSolution->addFrontDescription (description);
-                                } else {
-                                    description = str::Format(_("do not ask to install a solvable providing %1%") ) % pool_dep2str(pool, what);
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                }
-                                }
-                                break;
-                            case SOLVER_ERASE | SOLVER_SOLVABLE_PROVIDES:
-                                {
-                                problemSolution->addSingleAction (Capability(what), REMOVE_EXTRA_CONFLICT);
-                                std::string description = "";
-
-                                // Checking if this problem solution would break your system
-                                if (system_conflicts.find(Capability(what)) != system_conflicts.end()) {
-                                    // Show a better warning
-                                    resolverProblem->setDetails( resolverProblem->description() + "\n" + resolverProblem->details() );
-                                    resolverProblem->setDescription(_("This request will break your system!"));
-                                    description = _("ignore the warning of a broken system");
-                                    description += std::string(" (conflicts:")+pool_dep2str(pool, what)+")";
-                                    MIL << description << endl;
-                                    problemSolution->addFrontDescription (description);
-
-                                } else {
-                                    description = str::Format(_("do not ask to delete all solvables providing %1%") ) % pool_dep2str(pool, what);
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                }
-                                }
-                                break;
-                            case SOLVER_UPDATE | SOLVER_SOLVABLE:
-                                {
-                                s = mapSolvable (what);
-                                PoolItem poolItem = _pool.find (s);
-                                if (poolItem) {
-                                    if (pool->installed && s.get()->repo == pool->installed) {
-                                        problemSolution->addSingleAction (poolItem, KEEP);
-                                        std::string description = str::Format(_("do not install most recent version of %1%") ) % s.asString();
-                                        MIL << description << endl;
-                                        problemSolution->addDescription (description);
-                                    } else {
-                                        ERR << "SOLVER_INSTALL_SOLVABLE_UPDATE " << poolItem << " is not selected for installation" << endl;
-                                    }
-                                } else {
-                                    ERR << "SOLVER_INSTALL_SOLVABLE_UPDATE: No item found for " << s.asString() << endl;
-                                }
-                                }
-                                break;
-                            default:
-                                MIL << "- do something different" << endl;
-                                ERR << "No valid solution available" << endl;
-                                break;
+                                if ( s.isKind<Patch>() )
+                                  ptfPatchHint.notInstallPatch( s );
+                            }
+                        } else {
+                            ERR << "SOLVER_INSTALL_SOLVABLE: No item found for " << s.asString() << endl;
                         }
-                    } else if (p == SOLVER_SOLUTION_INFARCH) {
-                        s = mapSolvable (rp);
+                    }
+                        break;
+                    case SOLVER_ERASE | SOLVER_SOLVABLE: {
+                        s = mapSolvable (what);
                         PoolItem poolItem = _pool.find (s);
-                        if (pool->installed && s.get()->repo == pool->installed) {
-                            problemSolution->addSingleAction (poolItem, LOCK);
-                            std::string description = str::Format(_("keep %1% despite the inferior architecture") ) % s.asString();
+                        if (poolItem) {
+                            if (pool->installed && s.get()->repo == pool->installed) {
+                                problemSolution->addSingleAction (poolItem, KEEP);
+                                std::string description = str::Format(_("keep %1%") ) % s.asString();
+                                MIL << description << endl;
+                                problemSolution->addDescription (description);
+                            } else {
+                                problemSolution->addSingleAction (poolItem, UNLOCK);
+                                std::string description = str::Format(_("remove lock to allow installation of %1%") ) % itemToString( poolItem );
+                                MIL << description << endl;
+                                problemSolution->addDescription (description);
+                            }
+                        } else {
+                            ERR << "SOLVER_ERASE_SOLVABLE: No item found for " << s.asString() << endl;
+                        }
+                    }
+                        break;
+                    case SOLVER_INSTALL | SOLVER_SOLVABLE_NAME:
+                        {
+                        IdString ident( what );
+                        SolverQueueItemInstall_Ptr install =
+                            new SolverQueueItemInstall(_pool, ident.asString(), false );
+                        problemSolution->addSingleAction (install, REMOVE_SOLVE_QUEUE_ITEM);
+
+                        std::string description = str::Format(_("do not install %1%") ) % ident;
+                        MIL << description << endl;
+                        problemSolution->addDescription (description);
+                        }
+                        break;
+                    case SOLVER_ERASE | SOLVER_SOLVABLE_NAME:
+                        {
+                        // As we do not know, if this request has come from resolvePool or
+                        // resolveQueue we will have to take care for both cases.
+                        IdString ident( what );
+                        FindPackage info (problemSolution, KEEP);
+                        invokeOnEach( _pool.byIdentBegin( ident ),
+                                      _pool.byIdentEnd( ident ),
+                                      functor::chain (resfilter::ByInstalled (),			// ByInstalled
+                                                      resfilter::ByTransact ()),			// will be deinstalled
+                                      std::ref(info) );
+
+                        SolverQueueItemDelete_Ptr del =
+                            new SolverQueueItemDelete(_pool, ident.asString(), false );
+                        problemSolution->addSingleAction (del, REMOVE_SOLVE_QUEUE_ITEM);
+
+                        std::string description = str::Format(_("keep %1%") ) % ident;
+                        MIL << description << endl;
+                        problemSolution->addDescription (description);
+                        }
+                        break;
+                    case SOLVER_INSTALL | SOLVER_SOLVABLE_PROVIDES:
+                        {
+                        problemSolution->addSingleAction (Capability(what), REMOVE_EXTRA_REQUIRE);
+                        std::string description = "";
+
+                        // Checking if this problem solution would break your system
+                        if (system_requires.find(Capability(what)) != system_requires.end()) {
+                            // Show a better warning
+                            resolverProblem.setDetails( resolverProblem.description() + "\n" + resolverProblem.details() );
+                            resolverProblem.setDescription(_("This request will break your system!"));
+                            description = _("ignore the warning of a broken system");
+                            description += std::string(" (requires:")+pool_dep2str(pool, what)+")";
                             MIL << description << endl;
-                            problemSolution->addDescription (description);
+                            problemSolution->addFrontDescription (description);
                         } else {
-                            problemSolution->addSingleAction (poolItem, INSTALL);
-                            std::string description = str::Format(_("install %1% despite the inferior architecture") ) % s.asString();
+                            description = str::Format(_("do not ask to install a solvable providing %1%") ) % pool_dep2str(pool, what);
                             MIL << description << endl;
                             problemSolution->addDescription (description);
                         }
-                    } else if (p == SOLVER_SOLUTION_DISTUPGRADE) {
-                        s = mapSolvable (rp);
-                        PoolItem poolItem = _pool.find (s);
-                        if (pool->installed && s.get()->repo == pool->installed) {
-                            problemSolution->addSingleAction (poolItem, LOCK);
-                            std::string description = str::Format(_("keep obsolete %1%") ) % s.asString();
+                        }
+                        break;
+                    case SOLVER_ERASE | SOLVER_SOLVABLE_PROVIDES:
+                        {
+                        problemSolution->addSingleAction (Capability(what), REMOVE_EXTRA_CONFLICT);
+                        std::string description = "";
+
+                        // Checking if this problem solution would break your system
+                        if (system_conflicts.find(Capability(what)) != system_conflicts.end()) {
+                            // Show a better warning
+                            resolverProblem.setDetails( resolverProblem.description() + "\n" + resolverProblem.details() );
+                            resolverProblem.setDescription(_("This request will break your system!"));
+                            description = _("ignore the warning of a broken system");
+                            description += std::string(" (conflicts:")+pool_dep2str(pool, what)+")";
                             MIL << description << endl;
-                            problemSolution->addDescription (description);
+                            problemSolution->addFrontDescription (description);
+
                         } else {
-                            problemSolution->addSingleAction (poolItem, INSTALL);
-                            std::string description = str::Format(_("install %1% from excluded repository") ) % s.asString();
+                            description = str::Format(_("do not ask to delete all solvables providing %1%") ) % pool_dep2str(pool, what);
                             MIL << description << endl;
                             problemSolution->addDescription (description);
                         }
-                    } else if ( p == SOLVER_SOLUTION_BLACK ) {
-                        // Allow to install a blacklisted package (PTF, retracted,...).
-                        // For not-installed items only
-                        s = mapSolvable (rp);
-                        PoolItem poolItem = _pool.find (s);
-
-                        problemSolution->addSingleAction (poolItem, INSTALL);
-                        std::string description;
-                        if ( s.isRetracted() ) {
-                          // translator: %1% is a package name
-                          description = str::Format(_("install %1% although it has been retracted")) % s.asString();
-                        } else if ( s.isPtf() ) {
-                          // translator: %1% is a package name
-                          description = str::Format(_("allow installing the PTF %1%")) % s.asString();
-                        } else {
-                          // translator: %1% is a package name
-                          description = str::Format(_("install %1% although it is blacklisted")) % s.asString();
                         }
-                        MIL << description << endl;
-                        problemSolution->addDescription( description );
-                    } else if ( p > 0 ) {
-                        /* policy, replace p with rp */
-                        s = mapSolvable (p);
-                        PoolItem itemFrom = _pool.find (s);
-                        if (rp)
+                        break;
+                    case SOLVER_UPDATE | SOLVER_SOLVABLE:
                         {
-                            int gotone = 0;
-
-                            sd = mapSolvable (rp);
-                            PoolItem itemTo = _pool.find (sd);
-                            if (itemFrom && itemTo) {
-                                problemSolution->addSingleAction (itemTo, INSTALL);
-                                int illegal = policy_is_illegal(_satSolver, s.get(), sd.get(), 0);
-
-                                if ((illegal & POLICY_ILLEGAL_DOWNGRADE) != 0)
-                                {
-                                    std::string description = str::Format(_("downgrade of %1% to %2%") ) % s.asString() % sd.asString();
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                    gotone = 1;
-                                }
-                                if ((illegal & POLICY_ILLEGAL_ARCHCHANGE) != 0)
-                                {
-                                    std::string description = str::Format(_("architecture change of %1% to %2%") ) % s.asString() % sd.asString();
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                    gotone = 1;
-                                }
-                                if ((illegal & POLICY_ILLEGAL_VENDORCHANGE) != 0)
-                                {
-                                    IdString s_vendor( s.vendor() );
-                                    IdString sd_vendor( sd.vendor() );
-                                    std::string description;
-                                    if ( s == sd ) // FIXME? Actually .ident() must be eq. But the more verbose 'else' isn't bad either.
-                                      description = str::Format(_("install %1% (with vendor change)\n  %2%  -->  %3%") )
-                                      % sd.asString()
-                                      % ( s_vendor ? s_vendor.c_str() : " (no vendor) " )
-                                      % ( sd_vendor ? sd_vendor.c_str() : " (no vendor) " );
-                                    else
-                                      description = str::Format(_("install %1% from vendor %2%\n  replacing %3% from vendor %4%") )
-                                      % sd.asString()  % ( sd_vendor ? sd_vendor.c_str() : " (no vendor) " )
-                                      % s.asString() % ( s_vendor ? s_vendor.c_str() : " (no vendor) " );
-
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                    gotone = 1;
-                                }
-                                if (!gotone) {
-                                    std::string description = str::Format(_("replacement of %1% with %2%") ) % s.asString() % sd.asString();
-                                    MIL << description << endl;
-                                    problemSolution->addDescription (description);
-                                }
+                        s = mapSolvable (what);
+                        PoolItem poolItem = _pool.find (s);
+                        if (poolItem) {
+                            if (pool->installed && s.get()->repo == pool->installed) {
+                                problemSolution->addSingleAction (poolItem, KEEP);
+                                std::string description = str::Format(_("do not install most recent version of %1%") ) % s.asString();
+                                MIL << description << endl;
+                                problemSolution->addDescription (description);
                             } else {
-                                ERR << s.asString() << " or "  << sd.asString() << " not found" << endl;
+                                ERR << "SOLVER_INSTALL_SOLVABLE_UPDATE " << poolItem << " is not selected for installation" << endl;
                             }
+                        } else {
+                            ERR << "SOLVER_INSTALL_SOLVABLE_UPDATE: No item found for " << s.asString() << endl;
+                        }
                         }
-                        else
+                        break;
+                    default:
+                        MIL << "- do something different" << endl;
+                        ERR << "No valid solution available" << endl;
+                        break;
+                }
+            } else if (p == SOLVER_SOLUTION_INFARCH) {
+                s = mapSolvable (rp);
+                PoolItem poolItem = _pool.find (s);
+                if (pool->installed && s.get()->repo == pool->installed) {
+                    problemSolution->addSingleAction (poolItem, LOCK);
+                    std::string description = str::Format(_("keep %1% despite the inferior architecture") ) % s.asString();
+                    MIL << description << endl;
+                    problemSolution->addDescription (description);
+                } else {
+                    problemSolution->addSingleAction (poolItem, INSTALL);
+                    std::string description = str::Format(_("install %1% despite the inferior architecture") ) % s.asString();
+                    MIL << description << endl;
+                    problemSolution->addDescription (description);
+                }
+            } else if (p == SOLVER_SOLUTION_DISTUPGRADE) {
+                s = mapSolvable (rp);
+                PoolItem poolItem = _pool.find (s);
+                if (pool->installed && s.get()->repo == pool->installed) {
+                    problemSolution->addSingleAction (poolItem, LOCK);
+                    std::string description = str::Format(_("keep obsolete %1%") ) % s.asString();
+                    MIL << description << endl;
+                    problemSolution->addDescription (description);
+                } else {
+                    problemSolution->addSingleAction (poolItem, INSTALL);
+                    std::string description = str::Format(_("install %1% from excluded repository") ) % s.asString();
+                    MIL << description << endl;
+                    problemSolution->addDescription (description);
+                }
+            } else if ( p == SOLVER_SOLUTION_BLACK ) {
+                // Allow to install a blacklisted package (PTF, retracted,...).
+                // For not-installed items only
+                s = mapSolvable (rp);
+                PoolItem poolItem = _pool.find (s);
+
+                problemSolution->addSingleAction (poolItem, INSTALL);
+                std::string description;
+                if ( s.isRetracted() ) {
+                  // translator: %1% is a package name
+                  description = str::Format(_("install %1% although it has been retracted")) % s.asString();
+                } else if ( s.isPtf() ) {
+                  // translator: %1% is a package name
+                  description = str::Format(_("allow installing the PTF %1%")) % s.asString();
+                } else {
+                  // translator: %1% is a package name
+                  description = str::Format(_("install %1% although it is blacklisted")) % s.asString();
+                }
+                MIL << description << endl;
+                problemSolution->addDescription( description );
+            } else if ( p > 0 ) {
+                /* policy, replace p with rp */
+                s = mapSolvable (p);
+                PoolItem itemFrom = _pool.find (s);
+                if (rp)
+                {
+                    int gotone = 0;
+
+                    sd = mapSolvable (rp);
+                    PoolItem itemTo = _pool.find (sd);
+                    if (itemFrom && itemTo) {
+                        problemSolution->addSingleAction (itemTo, INSTALL);
+                        int illegal = policy_is_illegal(_satSolver, s.get(), sd.get(), 0);
+
+                        if ((illegal & POLICY_ILLEGAL_DOWNGRADE) != 0)
                         {
-                            if (itemFrom) {
-                                std::string description = str::Format(_("deinstallation of %1%") ) % s.asString();
-                                MIL << description << endl;
-                                problemSolution->addDescription (description);
-                                problemSolution->addSingleAction (itemFrom, REMOVE);
-                                if ( s.isPtfMaster() )
-                                  ptfPatchHint.removePtf( s );
-                            }
+                            std::string description = str::Format(_("downgrade of %1% to %2%") ) % s.asString() % sd.asString();
+                            MIL << description << endl;
+                            problemSolution->addDescription (description);
+                            gotone = 1;
                         }
+                        if ((illegal & POLICY_ILLEGAL_ARCHCHANGE) != 0)
+                        {
+                            std::string description = str::Format(_("architecture change of %1% to %2%") ) % s.asString() % sd.asString();
+                            MIL << description << endl;
+                            problemSolution->addDescription (description);
+                            gotone = 1;
+                        }
+                        if ((illegal & POLICY_ILLEGAL_VENDORCHANGE) != 0)
+                        {
+                            IdString s_vendor( s.vendor() );
+                            IdString sd_vendor( sd.vendor() );
+                            std::string description;
+                            if ( s == sd ) // FIXME? Actually .ident() must be eq. But the more verbose 'else' isn't bad either.
+                              description = str::Format(_("install %1% (with vendor change)\n  %2%  -->  %3%") )
+                              % sd.asString()
+                              % ( s_vendor ? s_vendor.c_str() : " (no vendor) " )
+                              % ( sd_vendor ? sd_vendor.c_str() : " (no vendor) " );
+                            else
+                              description = str::Format(_("install %1% from vendor %2%\n  replacing %3% from vendor %4%") )
+                              % sd.asString()  % ( sd_vendor ? sd_vendor.c_str() : " (no vendor) " )
+                              % s.asString() % ( s_vendor ? s_vendor.c_str() : " (no vendor) " );
+
+                            MIL << description << endl;
+                            problemSolution->addDescription (description);
+                            gotone = 1;
+                        }
+                        if (!gotone) {
+                            std::string description = str::Format(_("replacement of %1% with %2%") ) % s.asString() % sd.asString();
+                            MIL << description << endl;
+                            problemSolution->addDescription (description);
+                        }
+                    } else {
+                        ERR << s.asString() << " or "  << sd.asString() << " not found" << endl;
                     }
-                    else
-                    {
-                      INT << "Unknown solution " << p << endl;
+                }
+                else
+                {
+                    if (itemFrom) {
+                        std::string description = str::Format(_("deinstallation of %1%") ) % s.asString();
+                        MIL << description << endl;
+                        problemSolution->addDescription (description);
+                        problemSolution->addSingleAction (itemFrom, REMOVE);
+                        if ( s.isPtfMaster() )
+                          ptfPatchHint.removePtf( s );
                     }
-
                 }
-                resolverProblem->addSolution (problemSolution,
-                                              problemSolution->actionCount() > 1 ? true : false); // Solutions with more than 1 action will be shown first.
-                MIL << "------------------------------------" << endl;
             }
-
-            if (ignoreId > 0) {
-                // There is a possibility to ignore this error by setting weak dependencies
-                PoolItem item = _pool.find (sat::Solvable(ignoreId));
-                ProblemSolutionIgnore *problemSolution = new ProblemSolutionIgnore(item);
-                resolverProblem->addSolution (problemSolution,
-                                              false); // Solutions will be shown at the end
-                MIL << "ignore some dependencies of " << item << endl;
-                MIL << "------------------------------------" << endl;
+            else
+            {
+              INT << "Unknown solution " << p << endl;
             }
 
-            // bsc#1194848 hint on ptf<>patch conflicts
-            if ( ptfPatchHint.applies() ) {
-              resolverProblem->setDescription( str::Str() << ptfPatchHint.description() << endl << "(" << resolverProblem->description() << ")" );
-            }
-            // save problem
-            resolverProblems.push_back (resolverProblem);
         }
+        resolverProblem.addSolution (problemSolution,
+                                      problemSolution->actionCount() > 1 ? true : false); // Solutions with more than 1 action will be shown first.
+        MIL << "------------------------------------" << endl;
+    }
+
+    if (ignoreId > 0) {
+        // There is a possibility to ignore this error by setting weak dependencies
+        PoolItem item = _pool.find (sat::Solvable(ignoreId));
+        ProblemSolutionIgnore *problemSolution = new ProblemSolutionIgnore(item);
+        resolverProblem.addSolution (problemSolution,
+                                      false); // Solutions will be shown at the end
+        MIL << "ignore some dependencies of " << item << endl;
+        MIL << "------------------------------------" << endl;
+    }
+
+
+    // bsc#1194848 hint on ptf<>patch conflicts
+    if ( ptfPatchHint.applies() ) {
+      resolverProblem.setDescription( str::Str() << ptfPatchHint.description() << endl << "(" << resolverProblem.description() << ")" );
     }
-    return resolverProblems;
 }
 
 void SATResolver::applySolutions( const ProblemSolutionList & solutions )
@@ -33,6 +33,7 @@ extern "C"
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 
 #include <zypp/solver/Types.h>
@@ -84,6 +85,10 @@ class SATResolver : public base::ReferenceCounted, private base::NonCopyable, pr
     PoolItemList _result_items_to_install;
     PoolItemList _result_items_to_remove;
 
+    // problems handed out by problems(), computed on demand
+    ResolverProblemList _pendingProblems;
+    std::shared_ptr<void> _problemsToken;	// expires when the solver is reset
+
   public:
     ResolverFocus _focus;		// The resolver's general attitude
 
@@ -115,6 +120,10 @@ class SATResolver : public base::ReferenceCounted, private base::NonCopyable, pr
     std::string SATprobleminfoString (Id problem, std::string &detail, Id &ignoreId);
     std::string SATproblemRuleInfoString (Id rule, std::string &detail, Id &ignoreId);
     std::vector<std::string> SATgetCompleteProblemInfoStrings ( Id problem );
+    // fill in description and solutions of a problem handed out by problems()
+    void computeProblem( ResolverProblem & resolverProblem, Id problem, int pcnt );
+    // compute the problems still in use before the solver is reset
+    void computePendingProblems();
     void resetItemTransaction (PoolItem item);
 
     // Create a SAT solver and
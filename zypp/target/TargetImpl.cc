@@ -1351,7 +1351,7 @@ namespace zypp
         MIL << "Restrict to media number " << policy_r.restrictToMedia() << endl;
         for_( it, result.transaction().begin(), result.transaction().end() )
         {
-          if ( makeResObject( *it )->mediaNr() > 1 )
+          if ( it->satSolvable().mediaNr() > 1 )
             break;
           steps.push_back( *it );
         }
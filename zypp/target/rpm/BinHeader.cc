@@ -48,7 +48,7 @@ namespace rpm
   struct HeaderEntryGetter : private base::NonCopyable
   {
     public:
-      HeaderEntryGetter(const Header &h_r, rpmTag &tag_r);
+      HeaderEntryGetter(const Header &h_r, rpmTag &tag_r, bool minMem_r = false);
 
       HeaderEntryGetter(const HeaderEntryGetter &) = delete;
       HeaderEntryGetter(HeaderEntryGetter &&) = delete;
@@ -59,6 +59,10 @@ namespace rpm
       rpmTagType  type();
       rpm_count_t cnt();
       void *      val();
+      /** Whether \ref val was allocated (i.e. does not point into the header). */
+      bool        allocated();
+      /** Take over the retrieved data; \ref val stays valid as long as the returned pointer exists. */
+      shared_ptr<void> release();
     private:
 #ifndef _RPM_5
      ::rpmtd		_rpmtd;
@@ -70,16 +74,23 @@ namespace rpm
  };
 
 #ifndef _RPM_5
-  inline HeaderEntryGetter::HeaderEntryGetter( const Header & h_r, rpmTag & tag_r )
+  inline HeaderEntryGetter::HeaderEntryGetter( const Header & h_r, rpmTag & tag_r, bool minMem_r )
     : _rpmtd( ::rpmtdNew() )
-  { ::headerGet( h_r, tag_r, _rpmtd, HEADERGET_DEFAULT ); }
+  { ::headerGet( h_r, tag_r, _rpmtd, minMem_r ? HEADERGET_MINMEM : HEADERGET_DEFAULT ); }
   inline HeaderEntryGetter::~HeaderEntryGetter()
-  { ::rpmtdFreeData( _rpmtd ); ::rpmtdFree( _rpmtd ); }
+  { if ( _rpmtd ) { ::rpmtdFreeData( _rpmtd ); ::rpmtdFree( _rpmtd ); } }
   inline rpmTagType	HeaderEntryGetter::type()	{ return rpmtdType( _rpmtd ); }
   inline rpm_count_t	HeaderEntryGetter::cnt()	{ return _rpmtd->count; }
   inline void *		HeaderEntryGetter::val()	{ return _rpmtd->data; }
+  inline bool		HeaderEntryGetter::allocated()	{ return _rpmtd->flags & RPMTD_ALLOCED; }
+  inline shared_ptr<void> HeaderEntryGetter::release()
+  {
+    ::rpmtd td = _rpmtd;
+    _rpmtd = nullptr;
+    return shared_ptr<void>( td, []( void * p ) { ::rpmtdFreeData( (::rpmtd)p ); ::rpmtdFree( (::rpmtd)p ); } );
+  }
 #else
-  inline HeaderEntryGetter::HeaderEntryGetter( const Header & h_r, rpmTag & tag_r )
+  inline HeaderEntryGetter::HeaderEntryGetter( const Header & h_r, rpmTag & tag_r, bool )
     : _type( RPM_NULL_TYPE )
     , _cnt( 0 )
     , _val( 0 )
@@ -89,6 +100,15 @@ namespace rpm
   inline rpmTagType	HeaderEntryGetter::type()	{ return _type; }
   inline rpm_count_t	HeaderEntryGetter::cnt()	{ return _cnt; }
   inline void *		HeaderEntryGetter::val()	{ return _val; }
+  inline bool		HeaderEntryGetter::allocated()	{ return _type == RPM_STRING_ARRAY_TYPE; }
+  inline shared_ptr<void> HeaderEntryGetter::release()
+  {
+    void * val = _val;
+    _val = 0;
+    if ( val && _type == RPM_STRING_ARRAY_TYPE )
+      return shared_ptr<void>( val, ::free );
+    return shared_ptr<void>();
+  }
 #endif //_RPM_5
 
 ///////////////////////////////////////////////////////////////////
@@ -401,6 +421,49 @@ std::string BinHeader::string_val( tag tag_r ) const
   return "";
 }
 
+///////////////////////////////////////////////////////////////////
+//
+//
+//        METHOD NAME : BinHeader::stringViewList_val
+//        METHOD TYPE : BinHeader::stringViewList
+//
+//        DESCRIPTION :
+//
+BinHeader::stringViewList BinHeader::stringViewList_val( tag tag_r ) const
+{
+  stringViewList ret;
+
+  if ( !empty() )
+  {
+    HeaderEntryGetter headerget( _h, tag_r, /*minMem*/true );
+
+    if ( headerget.val() )
+    {
+      switch ( headerget.type() )
+      {
+      case RPM_NULL_TYPE:
+        break;
+      case RPM_STRING_ARRAY_TYPE:
+      {
+        char ** val = (char**)headerget.val();
+        ret._data.reserve( headerget.cnt() );
+        for ( unsigned i = 0; i < headerget.cnt(); ++i )
+          ret._data.push_back( val[i] );
+        // The strings point into the header (or into data we keep).
+        if ( refCount() )
+          ret._hdr = this;
+        ret._keep = headerget.release();
+      }
+        break;
+
+      default:
+        INT << "RPM_TAG MISMATCH: RPM_STRING_ARRAY_TYPE " << tag_r << " got type " << headerget.type() << endl;
+      }
+    }
+  }
+  return ret;
+}
+
 std::string BinHeader::format(const char *fmt) const
 {
   zypp::AutoDispose<char *> form(headerFormat(_h, fmt, NULL), free);
@@ -429,11 +492,9 @@ std::list<std::string> BinHeader::stringList_val( tag tag_r ) const
 
   if ( !empty() )
   {
-    stringList lines;
-    unsigned count = string_list( tag_r, lines );
-    for ( unsigned i = 0; i < count; ++i )
+    for ( std::string_view line : stringViewList_val( tag_r ) )
     {
-      ret.push_back( lines[i] );
+      ret.push_back( std::string( line ) );
     }
   }
   return ret;
@@ -19,6 +19,7 @@ extern "C"
 
 #include <iosfwd>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <list>
 
@@ -55,6 +56,8 @@ public:
 
   class stringList;
 
+  class stringViewList;
+
 private:
 
   Header _h;
@@ -93,6 +96,13 @@ public:
   std::string string_val( tag tag_r ) const;
   std::string format ( const char * fmt) const;
 
+  /** As \ref string_list, but not copying the data.
+   * The returned list refers to the headers data. If this \ref BinHeader
+   * is refcounted (i.e. held by a \ref Ptr), the list holds a reference,
+   * otherwise it is valid as long as this \ref BinHeader exists.
+   */
+  stringViewList stringViewList_val( tag tag_r ) const;
+
   Header get() const;
 
 public:
@@ -167,6 +177,45 @@ class BinHeader::stringList : private base::NonCopyable
 
 ///////////////////////////////////////////////////////////////////
 
+///////////////////////////////////////////////////////////////////
+//
+//	CLASS NAME : BinHeader::stringViewList
+/**
+ * String array tag data viewed in place (see \ref BinHeader::stringViewList_val).
+ * The viewed strings are NUL terminated.
+ **/
+class BinHeader::stringViewList
+{
+  public:
+    using const_iterator = std::vector<std::string_view>::const_iterator;
+
+    stringViewList()
+    {}
+
+    bool empty() const
+    { return _data.empty(); }
+
+    unsigned size() const
+    { return _data.size(); }
+
+    std::string_view operator[]( const unsigned idx_r ) const
+    { return idx_r < _data.size() ? _data[idx_r] : std::string_view( "" ); }
+
+    const_iterator begin() const
+    { return _data.begin(); }
+
+    const_iterator end() const
+    { return _data.end(); }
+
+  private:
+    friend class BinHeader;
+    BinHeader::constPtr _hdr;		///< keep the header alive (if refcounted)
+    shared_ptr<void> _keep;		///< data not owned by the header (_RPM_5)
+    std::vector<std::string_view> _data;
+};
+
+///////////////////////////////////////////////////////////////////
+
 } // namespace rpm
 } // namespace target
 } // namespace zypp
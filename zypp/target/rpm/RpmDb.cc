@@ -1753,9 +1753,7 @@ void RpmDb::doInstallPackage( const Pathname & filename, RpmInstFlags flags, Rpm
   {
     if ( str::startsWith( line, "%%" ) )
     {
-      int percent = 0;
-      sscanf( line.c_str() + 2, "%d", &percent );
-      report->progress( percent );
+      report->progress( strv::strtonum<int>( std::string_view( line ).substr( 2 ) ) );
       continue;
     }
     if ( str::hasPrefix( line, "dump_posttrans:" ) ) {
@@ -483,25 +483,22 @@ CapabilitySet RpmHeader::PkgRelList_val( tag tag_r, bool pre, std::set<std::stri
       break;
     }
 
-    stringList names;
-    unsigned count = string_list( tag_r, names );
+    const stringViewList names { stringViewList_val( tag_r ) };
+    unsigned count = names.size();
     if ( !count )
       return ret;
 
     intList  flags;
     int_list( kindFlags, flags );
 
-    stringList versions;
-    string_list( kindVersion, versions );
+    const stringViewList versions { stringViewList_val( kindVersion ) };
 
     for ( unsigned i = 0; i < count; ++i )
     {
-
-      std::string n( names[i] );
-
-      Rel op = Rel::ANY;
       int32_t f = flags[i];
-      std::string v = versions[i];
+      // views are NUL terminated
+      const char * n = names[i].data();
+      const char * v = versions[i].data();
 
       if ( n[0] == '/' )
       {
@@ -510,43 +507,42 @@ CapabilitySet RpmHeader::PkgRelList_val( tag tag_r, bool pre, std::set<std::stri
           freq_r->insert( n );
         }
       }
-      else
+
+      if ( pre ? !(f & RPMSENSE_PREREQ) : (f & RPMSENSE_PREREQ) )
+        continue;
+
+      Rel op = Rel::ANY;
+      if ( n[0] != '/' && *v )
       {
-        if ( v.size() )
+        switch ( f & RPMSENSE_SENSEMASK )
         {
-          switch ( f & RPMSENSE_SENSEMASK )
-          {
-          case RPMSENSE_LESS:
-            op = Rel::LT;
-            break;
-          case RPMSENSE_LESS|RPMSENSE_EQUAL:
-            op = Rel::LE;
-            break;
-          case RPMSENSE_GREATER:
-            op = Rel::GT;
-            break;
-          case RPMSENSE_GREATER|RPMSENSE_EQUAL:
-            op = Rel::GE;
-            break;
-          case RPMSENSE_EQUAL:
-            op = Rel::EQ;
-            break;
-          }
+        case RPMSENSE_LESS:
+          op = Rel::LT;
+          break;
+        case RPMSENSE_LESS|RPMSENSE_EQUAL:
+          op = Rel::LE;
+          break;
+        case RPMSENSE_GREATER:
+          op = Rel::GT;
+          break;
+        case RPMSENSE_GREATER|RPMSENSE_EQUAL:
+          op = Rel::GE;
+          break;
+        case RPMSENSE_EQUAL:
+          op = Rel::EQ;
+          break;
         }
       }
-      if ((pre && (f & RPMSENSE_PREREQ))
-          || ((! pre) && !(f & RPMSENSE_PREREQ)))
+
+      try
       {
-        try
-        {
-          ret.insert( Capability( n, op, Edition(v) ) );
-        }
-        catch (Exception & excpt_r)
-        {
-          ZYPP_CAUGHT(excpt_r);
-          WAR << "Invalid capability: " << n << " " << op << " "
-          << v << endl;
-        }
+        ret.insert( Capability( n, op, Edition(v) ) );
+      }
+      catch (Exception & excpt_r)
+      {
+        ZYPP_CAUGHT(excpt_r);
+        WAR << "Invalid capability: " << n << " " << op << " "
+        << v << endl;
       }
     }
 
@@ -924,16 +920,18 @@ std::list<std::string> RpmHeader::tag_filenames() const
 {
   std::list<std::string> ret;
 
-  stringList basenames;
-  if ( string_list( RPMTAG_BASENAMES, basenames ) )
+  const stringViewList basenames { stringViewList_val( RPMTAG_BASENAMES ) };
+  if ( ! basenames.empty() )
   {
-    stringList dirnames;
-    string_list( RPMTAG_DIRNAMES, dirnames );
+    const stringViewList dirnames { stringViewList_val( RPMTAG_DIRNAMES ) };
     intList  dirindexes;
     int_list( RPMTAG_DIRINDEXES, dirindexes );
     for ( unsigned i = 0; i < basenames.size(); ++ i )
     {
-      ret.push_back( dirnames[dirindexes[i]] + basenames[i] );
+      std::string_view dir { dirnames[dirindexes[i]] };
+      std::string & file { ret.emplace_back() };
+      file.reserve( dir.size() + basenames[i].size() );
+      file.append( dir ).append( basenames[i] );
     }
   }
 
@@ -952,21 +950,17 @@ std::list<FileInfo> RpmHeader::tag_fileinfos() const
 {
   std::list<FileInfo> ret;
 
-  stringList basenames;
-  if ( string_list( RPMTAG_BASENAMES, basenames ) )
+  const stringViewList basenames { stringViewList_val( RPMTAG_BASENAMES ) };
+  if ( ! basenames.empty() )
   {
-    stringList dirnames;
-    string_list( RPMTAG_DIRNAMES, dirnames );
+    const stringViewList dirnames { stringViewList_val( RPMTAG_DIRNAMES ) };
     intList  dirindexes;
     int_list( RPMTAG_DIRINDEXES, dirindexes );
     intList filesizes;
     int_list( RPMTAG_FILESIZES, filesizes );
-    stringList md5sums;
-    string_list( RPMTAG_FILEMD5S, md5sums );
-    stringList usernames;
-    string_list( RPMTAG_FILEUSERNAME, usernames );
-    stringList groupnames;
-    string_list( RPMTAG_FILEGROUPNAME, groupnames );
+    const stringViewList md5sums { stringViewList_val( RPMTAG_FILEMD5S ) };
+    const stringViewList usernames { stringViewList_val( RPMTAG_FILEUSERNAME ) };
+    const stringViewList groupnames { stringViewList_val( RPMTAG_FILEGROUPNAME ) };
     intList uids;
     int_list( RPMTAG_FILEUIDS, uids );
     intList gids;
@@ -977,15 +971,14 @@ std::list<FileInfo> RpmHeader::tag_fileinfos() const
     int_list( RPMTAG_FILEMTIMES, filemtimes );
     intList fileflags;
     int_list( RPMTAG_FILEFLAGS, fileflags );
-    stringList filelinks;
-    string_list( RPMTAG_FILELINKTOS, filelinks );
+    const stringViewList filelinks { stringViewList_val( RPMTAG_FILELINKTOS ) };
 
     for ( unsigned i = 0; i < basenames.size(); ++ i )
     {
       uid_t uid = 0;
       if (uids.empty())
       {
-        uid = unameToUid( usernames[i].c_str(), &uid );
+        uid = unameToUid( usernames[i].data(), &uid );
       }
       else
       {
@@ -995,23 +988,26 @@ std::list<FileInfo> RpmHeader::tag_fileinfos() const
       gid_t gid = 0;
       if (gids.empty())
       {
-        gid = gnameToGid( groupnames[i].c_str(), &gid );
+        gid = gnameToGid( groupnames[i].data(), &gid );
       }
       else
       {
         gid = gids[i];
       }
 
+      std::string filename { dirnames[dirindexes[i]] };
+      filename.append( basenames[i] );
+
       FileInfo info = {
-                        dirnames[dirindexes[i]] + basenames[i],
+                        std::move(filename),
                         filesizes[i],
-                        md5sums[i],
+                        std::string(md5sums[i]),
                         uid,
                         gid,
                         mode_t(filemodes[i]),
                         filemtimes[i],
                         bool(fileflags[i] & RPMFILE_GHOST),
-                        filelinks[i]
+                        std::string(filelinks[i])
                       };
 
       ret.push_back( info );
@@ -1030,23 +1026,48 @@ std::list<FileInfo> RpmHeader::tag_fileinfos() const
 //        DESCRIPTION :
 //
 Changelog RpmHeader::tag_changelog() const
-{
-  Changelog ret;
+{ return tag_changelogView().asChangelog(); }
 
-  intList times;
-  if ( int_list( RPMTAG_CHANGELOGTIME, times ) )
+namespace
+{
+  /** ChangelogView::Source viewing the changelog tags in place. */
+  struct HeaderChangelogSource : public ChangelogView::Source
   {
-    stringList names;
-    string_list( RPMTAG_CHANGELOGNAME, names );
-    stringList texts;
-    string_list( RPMTAG_CHANGELOGTEXT, texts );
-    for ( unsigned i = 0; i < times.size(); ++ i )
-    {
-      ret.push_back( ChangelogEntry( times[i], names[i], texts[i] ) );
-    }
-  }
+    unsigned size() const override
+    { return _times.size(); }
 
-  return ret;
+    Date date( unsigned idx_r ) const override
+    { return _times[idx_r]; }
+
+    std::string_view author( unsigned idx_r ) const override
+    { return _names[idx_r]; }
+
+    std::string_view text( unsigned idx_r ) const override
+    { return _texts[idx_r]; }
+
+    BinHeader::intList _times;
+    BinHeader::stringViewList _names;
+    BinHeader::stringViewList _texts;
+  };
+} // namespace
+
+///////////////////////////////////////////////////////////////////
+//
+//
+//        METHOD NAME : RpmHeader::tag_changelogView
+//        METHOD TYPE : ChangelogView
+//
+//        DESCRIPTION :
+//
+ChangelogView RpmHeader::tag_changelogView() const
+{
+  auto source { std::make_shared<HeaderChangelogSource>() };
+  if ( ! int_list( RPMTAG_CHANGELOGTIME, source->_times ) )
+    return ChangelogView();
+
+  source->_names = stringViewList_val( RPMTAG_CHANGELOGNAME );
+  source->_texts = stringViewList_val( RPMTAG_CHANGELOGTEXT );
+  return ChangelogView( std::move(source) );
 }
 
 } // namespace rpm
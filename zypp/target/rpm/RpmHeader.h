@@ -181,6 +181,9 @@ public:
 
   Changelog tag_changelog() const;
 
+  /** The changelog entries decoded on demand (keeps the header alive). */
+  ChangelogView tag_changelogView() const;
+
 public:
 
   std::ostream & dumpOn( std::ostream & str ) const override;
@@ -172,7 +172,7 @@ namespace zypp {
     // Used for trusted and untrusted keyrings
     filesystem::TmpDir _trusted_tmp_dir;
     filesystem::TmpDir _general_tmp_dir;
-    Pathname _base_dir;
+    filesystem::TmpArena _pubkey_arena;	//< Hosts the files exported by dumpPublicKeyToTmp.
     bool _allowPreload = false;	//< General keyring may be preloaded with keys cached on the system.
 
     /** Functor returning the keyrings data (cached).